@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Vec3.h"
+
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Axis Aligned Bounding Box (2D).
+ *
+ * AABB2 is the smallest rectangle with edges parallel to the x- and y-axis that contains a set of points or shapes.
+ * It is stored by its lower left corner `lo` and its upper right corner `hi`.
+ * The default constructed box is empty (`lo = +inf`, `hi = -inf`), so that it is the neutral element of [extend](@ref extend) and [unite](@ref unite).
+ */
+struct AABB2
+{
+    /// lower corner (minimal x and y)
+    Vec2 lo;
+    /// upper corner (maximal x and y)
+    Vec2 hi;
+
+    // Constructors
+    AABB2(const Vec2&, const Vec2&);
+    AABB2(const Vec2&);
+    AABB2();
+
+    // Properties
+    bool isEmpty() const;
+    Vec2 size() const;
+    Vec2 center() const;
+
+    // Methods
+    void extend(const Vec2&);
+    void extend(const AABB2&);
+    bool contains(const Vec2&) const;
+    bool contains(const AABB2&) const;
+    bool intersects(const AABB2&) const;
+    bool hit(const Vec2& origin, const Vec2& dir, Float& tnear, Float& tfar) const;
+    Float distance(const Vec2&) const;
+
+    // Debugging
+    friend std::ostream& operator << (std::ostream&, const AABB2&);
+};
+
+/**
+ * @brief Axis Aligned Bounding Box (3D).
+ *
+ * Three dimensional counterpart of [AABB2](@ref AABB2), stored by its corners `lo` and `hi`. The default constructed box is empty.
+ */
+struct AABB3
+{
+    /// lower corner (minimal x, y and z)
+    Vec3 lo;
+    /// upper corner (maximal x, y and z)
+    Vec3 hi;
+
+    // Constructors
+    AABB3(const Vec3&, const Vec3&);
+    AABB3(const Vec3&);
+    AABB3();
+
+    // Properties
+    bool isEmpty() const;
+    Vec3 size() const;
+    Vec3 center() const;
+
+    // Methods
+    void extend(const Vec3&);
+    void extend(const AABB3&);
+    bool contains(const Vec3&) const;
+    bool contains(const AABB3&) const;
+    bool intersects(const AABB3&) const;
+    bool hit(const Vec3& origin, const Vec3& dir, Float& tnear, Float& tfar) const;
+    Float distance(const Vec3&) const;
+
+    // Debugging
+    friend std::ostream& operator << (std::ostream&, const AABB3&);
+};
+
+// ----------------------------------------------
+// Namespace Methods
+
+AABB2 unite(const AABB2&, const AABB2&);
+AABB3 unite(const AABB3&, const AABB3&);
+AABB2 intersection(const AABB2&, const AABB2&);
+AABB3 intersection(const AABB3&, const AABB3&);
+
+// Bulk Bounds
+AABB2 bounds(const Vec2* points, std::size_t n);
+AABB3 bounds(const Vec3* points, std::size_t n);
+AABB2 bounds(const std::vector<Vec2>&);
+AABB3 bounds(const std::vector<Vec3>&);
+
+} /* vml */
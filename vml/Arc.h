@@ -2,6 +2,8 @@
 
 #include "Basics.h"
 #include "Vec2.h"
+#include "Transform.h"
+#include "AABB.h"
 
 #include <array>
 #include <vector>
@@ -61,15 +63,35 @@ struct Arc
     Float centralAngle() const;
     Vec2  center() const;
     bool reaches(Float) const;
+    AABB2 bounds() const;
     
     // Punkte auf dem Bogen
     Vec2 atAngle(Float) const;
     Vec2 atLength(Float) const;
     Vec2 end() const;
+    Vec2 closestPoint(const Vec2&) const;
+    Float lengthAt(const Vec2&) const;
+    Vec2 supportPoint(const Vec2& dir) const;
+    int intersect(const Vec2& origin, const Vec2& dir, Float t[2]) const;
+
+    /**
+     * @brief Richtung des Teststrahls für Punkt-in-Form-Tests.
+     *
+     * Winkel des Strahls, dessen Schnitte mit [intersect](@ref intersect) gezählt werden. Ein achsenparalleler Strahl liefe oft genau durch die Übergänge
+     * oder die tiefsten Punkte der Bögen, daher die schiefe Richtung. Alle Tests müssen dieselbe Richtung nutzen, damit sie auch in Grenzfällen übereinstimmen.
+     */
+    static constexpr Float probeAngle{ .6180339f };
 
     // Methoden
     void transform(Float, Vec2);
+    void transform(const Transform2&);
+    Arc offset(Float) const;
+    int samples(Float res = .3) const;
+    void sample(Vec2* output, int n) const;
+    void sample(Vec2* output, int n, Float first, Float step) const;
     void discretize(std::vector<Vec2>& output, Float res = .3) const;
+    int adaptiveSamples(Float tolerance) const;
+    void discretizeAdaptive(std::vector<Vec2>& output, Float tolerance) const;
     std::string TikZ() const;
     
     // Debugging
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "AABB.h"
+#include "ArcShape.h"
+
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Bounding Volume Hierarchy over the Arcs of an ArcShape.
+ *
+ * A binary tree of [AABB2](@ref AABB2)s, built from the exact [bounds](@ref Arc::bounds) of every arc.
+ * All queries are answered against the true arc geometry, not against a discretization, and only visit the arcs whose boxes can still contribute.
+ * The tree is built once and is immutable afterwards, so one ArcBVH can be queried from many threads at the same time.
+ *
+ * The nodes are stored in a flat array in depth first order: the left child of an inner node directly follows its parent, the right child is referenced by index.
+ * The arcs are reordered so that every leaf covers a contiguous range, `index` maps them back to their position in the shape.
+ */
+class ArcBVH
+{
+public:
+    /// maximal number of arcs per leaf
+    static const int leafSize{ 4 };
+
+    /// node of the tree
+    struct Node
+    {
+        /// bounds of all arcs below this node
+        AABB2 box;
+        /// first arc of a leaf
+        int first;
+        /// number of arcs of a leaf, 0 for inner nodes
+        int count;
+        /// index of the right child of an inner node
+        int right;
+    };
+
+    // Constructors
+    ArcBVH(const ArcShape&);
+
+    // Properties
+    std::size_t size() const;
+    const std::vector<Node>& nodes() const;
+    AABB2 bounds() const;
+
+    // Queries
+    Vec2 closestPoint(const Vec2&, std::size_t* arc = nullptr) const;
+    Float distance(const Vec2&) const;
+    Float signedDistance(const Vec2&) const;
+    bool contains(const Vec2&) const;
+    bool intersect(const Vec2& origin, const Vec2& dir, Float& t, std::size_t* arc = nullptr) const;
+
+    // Batch Queries
+    void closestPoints(const std::vector<Vec2>& points, std::vector<Vec2>& output) const;
+    void signedDistances(const std::vector<Vec2>& points, std::vector<Float>& output) const;
+    void intersect(const std::vector<Vec2>& origins, const std::vector<Vec2>& dirs, std::vector<Float>& t) const;
+
+private:
+    int build(int begin, int end, const std::vector<AABB2>& boxes);
+
+    /// the nodes, depth first
+    std::vector<Node> tree;
+    /// the arcs, reordered by leaf
+    std::vector<Arc> arcs;
+    /// position of every reordered arc in the shape
+    std::vector<std::size_t> index;
+};
+
+} /* vml */
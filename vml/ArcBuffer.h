@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Transform.h"
+#include "Arc.h"
+#include "ArcShape.h"
+
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Many ArcShapes in SoA Layout.
+ *
+ * Structure of arrays for the five parameters of many arcs: the i-th arc is `(x[i], y[i], ang[i], crv[i], lng[i])`.
+ * The arcs of all shapes are stored back to back, shape `k` covers the arcs `[offsets[k], offsets[k+1])`.
+ * Compared to a `std::vector<ArcShape>` there is one allocation per parameter instead of one per shape, and batch kernels like [transform](@ref transform) run over contiguous floats, which the compiler can vectorize.
+ * Single arcs and shapes are read back as [Arc](@ref Arc) and [ArcShape](@ref ArcShape) values.
+ */
+struct ArcBuffer
+{
+    /// x-coordinates of the start points
+    std::vector<Float> x;
+    /// y-coordinates of the start points
+    std::vector<Float> y;
+    /// start angles
+    std::vector<Float> ang;
+    /// curvatures
+    std::vector<Float> crv;
+    /// arc lengths
+    std::vector<Float> lng;
+    /// first arc of every shape, one entry more than shapes
+    std::vector<std::size_t> offsets;
+
+    // Constructors
+    ArcBuffer();
+
+    // Properties
+    std::size_t size() const;
+    std::size_t shapes() const;
+    std::size_t begin(std::size_t shape) const;
+    std::size_t end(std::size_t shape) const;
+
+    // Memory
+    void reserve(std::size_t arcs, std::size_t shapes);
+    void clear();
+    std::size_t allocate(std::size_t arcs, std::size_t count = 1);
+    std::size_t push_back(const ArcShape&);
+
+    // Views
+    Arc operator[] (std::size_t) const;
+    void set(std::size_t, const Arc&);
+    ArcShape shape(std::size_t) const;
+    void shape(std::size_t, ArcShape&) const;
+
+    // Batch Kernels
+    void transform(const Transform2&);
+    void transform(std::size_t shape, const Transform2&);
+    void transform(const std::vector<Transform2>& perShape);
+    void ends(std::vector<Vec2>& output) const;
+    void centers(std::vector<Vec2>& output) const;
+    void extents(const Vec2& axis, std::vector<Interval>& output) const;
+};
+
+} /* vml */
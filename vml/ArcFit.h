@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Arc.h"
+#include "ArcShape.h"
+
+#include <vector>
+
+namespace vml {
+
+// ----------------------------------------------
+// Arc Spline Fitting
+
+void fit(const std::vector<Vec2>& points, Float tolerance, ArcShape& shape);
+void fitChunked(const std::vector<Vec2>& points, Float tolerance, ArcShape& shape, std::size_t grain = 1 << 14);
+
+} /* vml */
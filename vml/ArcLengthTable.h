@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "ArcShape.h"
+
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Arc Length Parametrization of an ArcShape.
+ *
+ * Precomputes the prefix sums of the arc lengths and of the absolute central angles of a shape.
+ * A position along the whole shape is then found by binary search over the arcs instead of walking them linearly, so every lookup costs O(log n).
+ * The table copies the arcs, it stays valid if the shape is changed or destroyed afterwards. Build a new table after changing the shape.
+ *
+ * The shape is treated as closed: lengths and parameters wrap around, `atLength(length())` is the start point again.
+ */
+class ArcLengthTable
+{
+public:
+    // Constructors
+    ArcLengthTable(const ArcShape&);
+
+    // Properties
+    std::size_t size() const;
+    Float length() const;
+    Float angle() const;
+    Float lengthAt(std::size_t arc) const;
+    Float angleAt(std::size_t arc) const;
+
+    // Lookup
+    std::size_t locate(Float s) const;
+    Vec2 atLength(Float s) const;
+    Vec2 atParameter(Float t) const;
+    Vec2 atAngle(Float phi) const;
+
+    // Batch Sampling
+    void sample(Vec2* output, int n, Float first = 0.f) const;
+    void discretize(std::vector<Vec2>& points, int numberOfPoints) const;
+    void atLength(const std::vector<Float>& s, std::vector<Vec2>& output) const;
+
+private:
+    /// the arcs of the shape
+    std::vector<Arc> arcs;
+    /// length of the shape up to the start of every arc, one entry more than arcs
+    std::vector<Float> lengths;
+    /// sum of the absolute central angles up to the start of every arc, one entry more than arcs
+    std::vector<Float> angles;
+};
+
+} /* vml */
@@ -1,9 +1,32 @@
 #pragma once
 
 #include "Arc.h"
+#include "Interval.h"
 
 namespace vml {
 
+/**
+ * @brief Flächenmomente einer geschlossenen Form.
+ *
+ * Fläche, Umfang, Schwerpunkt und die zweiten Flächenmomente bezogen auf den Schwerpunkt.
+ * Die Fläche ist vorzeichenbehaftet: positiv für Formen gegen den Uhrzeigersinn, negativ im Uhrzeigersinn. Die Momente tragen dasselbe Vorzeichen.
+ */
+struct Moments
+{
+    /// vorzeichenbehaftete Fläche
+    Float area;
+    /// Umfang (Summe der Bogenlängen)
+    Float perimeter;
+    /// Flächenschwerpunkt
+    Vec2 centroid;
+    /// ∫∫ (x - cx)² dA
+    Float xx;
+    /// ∫∫ (y - cy)² dA
+    Float yy;
+    /// ∫∫ (x - cx)(y - cy) dA
+    Float xy;
+};
+
 /**
  * @brief Kreisbogenform, Aneinandereihung von mehreren Kreisbögen
  *
@@ -18,13 +41,35 @@ public:
 
     // Methoden
     void transform(Float, Vec2);
+    void transform(const Transform2&);
+    ArcShape offset(Float distance) const;
+    void offset(const std::vector<Float>& distances, std::vector<ArcShape>& output) const;
     std::vector<Vec2> lowestPoints() const;
+    void extremePoints(const Vec2& dir, std::vector<Vec2>& points) const;
+    Vec2 supportPoint(const Vec2& dir) const;
+    Float support(const Vec2& dir) const;
+    Interval extent(const Vec2& axis) const;
+    AABB2 bounds() const;
+    Float area() const;
+    Float perimeter() const;
+    Vec2 centroid() const;
+    Moments moments() const;
+    bool contains(const Vec2&) const;
     void discretize(std::vector<Vec2>& points, Float res=.3) const;
     void discretize(std::vector<Vec2>& points, int numberOfPoints) const;
+    void discretizeAdaptive(std::vector<Vec2>& points, Float tolerance) const;
     std::string TikZ(const char* optionals = "") const;
     
     // Debugging
     friend std::ostream& operator<< (std::ostream&, const ArcShape&);
 };
 
+// ----------------------------------------------
+// Batch Methoden
+
+Moments moments(const Arc* arcs, std::size_t n);
+void moments(const std::vector<ArcShape>& shapes, std::vector<Moments>& output);
+void supportPoints(const std::vector<ArcShape>& shapes, const Vec2& dir, std::vector<Vec2>& output);
+void extents(const std::vector<ArcShape>& shapes, const Vec2& axis, std::vector<Interval>& output);
+
 } /* vml */
@@ -2,9 +2,19 @@
 
 #include <iostream> // printing
 #include <cmath> // to use math every where
+#include <cassert> // assert in lerp
 
 namespace vml {
 
+/**
+ * @brief Betrag für Gleitkommazahlen.
+ *
+ * Nicht jede Standardbibliothek stellt die Gleitkomma-Überladungen von `abs` im globalen Namensraum bereit (z.B. libstdc++).
+ * Dort wird `abs(Float)` stillschweigend zu `abs(int)` und schneidet die Nachkommastellen ab.
+ * Mit dieser Deklaration findet jeder unqualifizierte Aufruf in vml die Überladungen aus `std`.
+ */
+using std::abs;
+
 /**
  * @brief The basic  floating point type for VML.
  *
@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Basics.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Contiguous Range.
+ *
+ * A pair of pointers into one of the arrays of a [CSRGraph](@ref CSRGraph), usable in range based for loops.
+ * It stays valid as long as the graph it points into.
+ */
+template<class T>
+struct Range
+{
+    const T* first;
+    const T* last;
+
+    const T* begin() const { return first; }
+    const T* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    bool empty() const { return first == last; }
+    const T& operator[] (std::size_t i) const { return first[i]; }
+};
+
+/**
+ * @class CSRGraph
+ * @brief Immutable Graph in Compressed Sparse Row Form.
+ *
+ * The frozen counterpart of [Graph](@ref Graph), created by [Graph::freeze](@ref Graph::freeze) or directly from an edge list with [fromEdges](@ref fromEdges).
+ * The outgoing edges of all nodes are stored in two contiguous arrays, `targets` (child indices) and `values` (edge data), sorted by parent.
+ * The edges of node `i` are the entries `offsets[i]` to `offsets[i+1]`, so iterating over the children of a node touches one contiguous block
+ * instead of a separately allocated list per node, and the parent index is not stored per edge.
+ * Nodes and edges can not be changed after construction.
+ *
+ * @tparam N node class
+ * @tparam E edge data class
+ */
+template<class N, class E = char>
+class CSRGraph
+{
+public:
+    /// Index type, the same as [Graph::Index](@ref Graph::Index).
+    typedef std::size_t Index;
+
+    /// No node, the same as [Graph::NoN](@ref Graph::NoN).
+    static constexpr Index NoN{ static_cast<Index>(-1) };
+
+    /// Entry of an edge list for [fromEdges](@ref fromEdges).
+    struct Edge
+    {
+        Index parent;
+        Index child;
+        E data;
+    };
+
+    /// Empty graph.
+    CSRGraph() : offsets{ 0 }
+    {}
+
+    /**
+     * @brief Array Constructor.
+     *
+     * Takes over prepared arrays: `offsets` has one entry more than `nodes`, starts with 0 and ends with the number of edges,
+     * `targets` and `values` have one entry per edge.
+     */
+    CSRGraph(std::vector<N> _nodes, std::vector<Index> _offsets, std::vector<Index> _targets, std::vector<E> _values) :
+        vertices{ std::move(_nodes) },
+        offsets{ std::move(_offsets) },
+        targets{ std::move(_targets) },
+        values{ std::move(_values) }
+    {
+        assert(offsets.size() == vertices.size() + 1);
+        assert(offsets.front() == 0 && offsets.back() == targets.size());
+        assert(targets.size() == values.size());
+    }
+
+    /**
+     * @brief Builder from an Edge List.
+     *
+     * Sorts the edges by parent with a counting sort in two linear passes, the order of the edges of each parent is kept.
+     * Works with every container of elements with the members `parent`, `child` and `data`, e.g. `std::vector<Edge>` or `std::vector<Graph<N,E>::Edge>`.
+     *
+     * @param nodes the nodes, every parent and child index has to be smaller than their number
+     * @param edges the edges in any order
+     */
+    template<class EdgeList>
+    static CSRGraph fromEdges(std::vector<N> nodes, const EdgeList& edges)
+    {
+        const std::size_t n{ nodes.size() };
+        std::vector<Index> offsets(n + 1, 0);
+        for (const auto& e : edges)
+        {
+            assert(e.parent < n && e.child < n);
+            offsets[e.parent + 1]++;
+        }
+        for (std::size_t i{0}; i < n; i++) offsets[i+1] += offsets[i];
+
+        std::vector<Index> targets(offsets[n]);
+        std::vector<E> values(offsets[n]);
+        std::vector<Index> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& e : edges)
+        {
+            const Index k{ cursor[e.parent]++ };
+            targets[k] = e.child;
+            values[k] = e.data;
+        }
+        return CSRGraph(std::move(nodes), std::move(offsets), std::move(targets), std::move(values));
+    }
+
+    /**
+     * @brief Reversed Graph.
+     *
+     * The graph with every edge reversed, i.e. the children of a node are its parents in this graph. Edge data is kept.
+     * Bottom-up traversals (see [parallelBfs](@ref parallelBfs)) look at the parents of a node and need it.
+     * Built with a counting sort in linear time, the parents of every node are sorted by index.
+     */
+    CSRGraph transpose() const
+    {
+        const std::size_t n{ size() };
+        std::vector<Index> rows(n + 1, 0);
+        for (const Index c : targets) rows[c + 1]++;
+        for (std::size_t i{0}; i < n; i++) rows[i+1] += rows[i];
+
+        std::vector<Index> parents(targets.size());
+        std::vector<E> data(targets.size());
+        std::vector<Index> cursor(rows.begin(), rows.end() - 1);
+        for (Index p{0}; p < n; p++)
+            for (Index k{ offsets[p] }; k < offsets[p+1]; k++)
+            {
+                const Index j{ cursor[targets[k]]++ };
+                parents[j] = p;
+                data[j] = values[k];
+            }
+        return CSRGraph(vertices, std::move(rows), std::move(parents), std::move(data));
+    }
+
+    // ----------------------------------------------
+    // Size
+
+    /// Number of nodes.
+    std::size_t size() const { return vertices.size(); }
+    /// Number of edges.
+    std::size_t edgeCount() const { return targets.size(); }
+    /// Number of outgoing edges of `node`.
+    std::size_t degree(Index node) const { return offsets[node+1] - offsets[node]; }
+
+    // ----------------------------------------------
+    // Access
+
+    /// All nodes.
+    const std::vector<N>& nodes() const { return vertices; }
+    /// The node at `index`.
+    const N& node(Index index) const { return vertices[index]; }
+
+    /// Indices of the children of `parent`.
+    Range<Index> children(Index parent) const
+    {
+        return Range<Index>{ targets.data() + offsets[parent], targets.data() + offsets[parent+1] };
+    }
+
+    /// Data of the outgoing edges of `parent`, in the same order as [children](@ref children).
+    Range<E> data(Index parent) const
+    {
+        return Range<E>{ values.data() + offsets[parent], values.data() + offsets[parent+1] };
+    }
+
+    /// Checks for an edge from `parent` to `child` by scanning the edges of `parent`.
+    bool isEdge(Index parent, Index child) const
+    {
+        if (parent >= size()) return false;
+        for (const Index c : children(parent))
+            if (c == child) return true;
+        return false;
+    }
+
+    /// Calls `predicate(child, data)` for every outgoing edge of `parent`, like [Graph::forEachChild](@ref Graph::forEachChild).
+    template<class F>
+    void forEachChild(Index parent, const F& predicate) const
+    {
+        for (Index k{ offsets[parent] }; k < offsets[parent+1]; k++) predicate(targets[k], values[k]);
+    }
+
+    /**
+     * @brief Iterate over all Edges.
+     *
+     * Calls `predicate(parent, child, data)` for every edge, ordered by parent.
+     */
+    void forEachEdge(const std::function<void(Index, Index, const E&)>& predicate) const
+    {
+        for (Index p{0}; p < size(); p++)
+            for (Index k{ offsets[p] }; k < offsets[p+1]; k++)
+                predicate(p, targets[k], values[k]);
+    }
+
+    // ----------------------------------------------
+    // Raw Arrays
+
+    /// Start of the edges of every node, with one additional entry for the end of the last node.
+    const std::vector<Index>& rowOffsets() const { return offsets; }
+    /// Child index of every edge.
+    const std::vector<Index>& childIndices() const { return targets; }
+    /// Data of every edge.
+    const std::vector<E>& edgeData() const { return values; }
+
+private:
+    /// nodes
+    std::vector<N> vertices;
+    /// first edge of every node, `size() + 1` entries
+    std::vector<Index> offsets;
+    /// child of every edge
+    std::vector<Index> targets;
+    /// data of every edge
+    std::vector<E> values;
+};
+
+} /* vml */
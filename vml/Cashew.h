@@ -1,7 +1,11 @@
 #pragma once
 
 #include "ArcShape.h"
+#include "ArcBuffer.h"
 #include "parse.h"
+#include "parallel.h"
+
+#include <cstdint>
 
 namespace vml {
 
@@ -25,12 +29,65 @@ struct Cashew
     Cashew(Float,Float,Float,Float);
     
     // Methoden
+    bool isValid() const;
     void construct(ArcShape&) const;
+    bool tryConstruct(ArcShape&) const;
     
     // Debugging
     friend std::ostream& operator<< (std::ostream&, const Cashew&);
 };
 
+/**
+ * @brief Viele Cashew-Parameter im SoA Layout.
+ *
+ * Die Parameter des i-ten Cashews sind `(d[i], r1[i], r2[i], g[i])`. Eingang für die Batch-Konstruktion und Parameter-Sweeps.
+ */
+struct Cashews
+{
+    std::vector<Float> d;
+    std::vector<Float> r1;
+    std::vector<Float> r2;
+    std::vector<Float> g;
+
+    // Methoden
+    std::size_t size() const;
+    void resize(std::size_t);
+    void clear();
+    void push_back(const Cashew&);
+    Cashew operator[] (std::size_t) const;
+};
+
+// ----------------------------------------------
+// Batch Konstruktion
+
+std::size_t construct(const Cashews& params, ArcBuffer& output, std::vector<std::uint8_t>& valid);
+
+/**
+ * @brief Paralleler Parameter-Sweep.
+ *
+ * Konstruiert die Form für jedes Parametertupel und übergibt sie an `f(index, shape, valid)`.
+ * Die Tupel werden auf alle Threads verteilt, jeder Thread benutzt eine einzige ArcShape für alle seine Tupel, es werden also keine Formen gespeichert.
+ * `f` wird gleichzeitig aus mehreren Threads aufgerufen und muss seine Ergebnisse selbst (z.B. nach `index`) getrennt ablegen.
+ * Es werden keine Warnungen ausgegeben, ungültige Parameter werden über `valid` gemeldet (siehe [tryConstruct](@ref Cashew::tryConstruct)).
+ *
+ * @param params die Parametertupel
+ * @param f Funktion mit der Signatur `void(std::size_t index, const ArcShape& shape, bool valid)`
+ * @param grain minimale Anzahl an Tupeln pro Thread
+ */
+template<typename F>
+void sweep(const Cashews& params, const F& f, std::size_t grain = 1 << 12)
+{
+    parallelFor(params.size(), grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        ArcShape shape;
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            const bool valid{ params[i].tryConstruct(shape) };
+            f(i, static_cast<const ArcShape&>(shape), valid);
+        }
+    });
+}
+
 // ----------------------------------------------
 // Parsing
 namespace parse
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "ArcShape.h"
+#include "Cashew.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief LRU Cache for Cashew Shapes.
+ *
+ * Interactive tools rebuild the same Cashew over and over. The cache keys shapes by their parameters `(d, r1, r2, g)`, quantized to a grid of spacing `tolerance`,
+ * so that all parameters within the same grid cell share one shape. The shape is built from the cell center, the result does not depend on which parameters hit the cell first.
+ * Shapes and their discretizations are returned as shared pointers to immutable data, they stay valid after being evicted.
+ * When more than `capacity` shapes are stored, the least recently used one is evicted.
+ * Every shape keeps the discretizations of its last [resolutions](@ref resolutions) resolutions, so memory stays bounded also for callers that vary the resolution.
+ * All methods are thread safe.
+ */
+class CashewCache
+{
+public:
+    using Shape = std::shared_ptr<const ArcShape>;
+    using Points = std::shared_ptr<const std::vector<Vec2>>;
+
+    // Constructors
+    CashewCache(std::size_t capacity = 1024, Float tolerance = 1e-4f);
+
+    // Lookup
+    Shape shape(const Cashew&);
+    Points discretization(const Cashew&, Float res = .3);
+
+    // Properties
+    std::size_t size() const;
+    std::size_t capacity() const;
+    Float tolerance() const;
+    std::size_t hits() const;
+    std::size_t misses() const;
+
+    // Methods
+    void clear();
+    void resetCounters();
+
+private:
+    /// quantized parameters
+    struct Key
+    {
+        std::int64_t d, r1, r2, g;
+        bool operator == (const Key&) const;
+    };
+    struct KeyHash
+    {
+        std::size_t operator() (const Key&) const;
+    };
+    /// maximal number of discretizations per shape
+    static constexpr std::size_t resolutions{ 4 };
+
+    /// a cached shape and its discretizations, one per resolution, most recently used first
+    struct Entry
+    {
+        Key key;
+        Shape shape;
+        std::vector<std::pair<Float, Points>> discretizations;
+    };
+
+    Key quantize(const Cashew&) const;
+    Entry& lookup(const Cashew&);
+
+    /// maximal number of shapes
+    std::size_t limit;
+    /// grid spacing of the parameters
+    Float step;
+    /// entries, most recently used first
+    std::list<Entry> entries;
+    /// position of every key in `entries`
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    /// number of lookups that found their data
+    std::size_t hitCount;
+    /// number of lookups that had to build their data
+    std::size_t missCount;
+    /// guards all members
+    mutable std::mutex mutex;
+};
+
+} /* vml */
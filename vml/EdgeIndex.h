@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Basics.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Hashed Edge Index.
+ *
+ * Open addressing hash table from `(parent, child)` to the position of that edge in the edge list of `parent`,
+ * used by [Graph](@ref Graph) for edge lookups and removals in expected constant time (see [Graph::enableIndex](@ref Graph::enableIndex)).
+ * Slots are probed linearly and removals shift the following entries back, so there are no tombstones and lookups stay short after many removals.
+ * The table grows at a load factor of 1/2.
+ * Parallel edges share one entry, which counts them and stores the position of one of them.
+ */
+class EdgeIndex
+{
+public:
+    typedef std::size_t Index;
+    static constexpr Index NoN{ static_cast<Index>(-1) };
+
+    EdgeIndex();
+
+    // Size
+    std::size_t size() const;
+    void clear();
+    void reserve(std::size_t keys);
+
+    // Lookup
+    Index find(Index parent, Index child) const;
+    std::size_t count(Index parent, Index child) const;
+
+    // Modification
+    void insert(Index parent, Index child, Index position);
+    void move(Index parent, Index child, Index from, Index to);
+    std::size_t erase(Index parent, Index child);
+
+private:
+    struct Slot
+    {
+        /// `NoN` for an empty slot
+        Index parent;
+        Index child;
+        Index position;
+        std::size_t count;
+    };
+
+    std::size_t home(Index parent, Index child) const;
+    std::size_t slot(Index parent, Index child) const;
+    void rehash(std::size_t capacity);
+
+    /// slots, a power of two
+    std::vector<Slot> slots;
+    /// number of used slots
+    std::size_t used;
+};
+
+} /* vml */
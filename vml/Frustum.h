@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec3.h"
+#include "Vec4.h"
+#include "Mat4.h"
+#include "AABB.h"
+
+#include <array>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Point Cloud in SoA Layout.
+ *
+ * Structure of arrays for 3D points: the i-th point is `(x[i], y[i], z[i])`.
+ * Compared to a `std::vector<Vec3>` each coordinate is contiguous, so batch kernels can process several points per instruction.
+ */
+struct Points3
+{
+    std::vector<Float> x;
+    std::vector<Float> y;
+    std::vector<Float> z;
+
+    // Methods
+    std::size_t size() const;
+    void resize(std::size_t);
+    void clear();
+    void push_back(const Vec3&);
+    Vec3 operator[] (std::size_t) const;
+};
+
+/**
+ * @brief Projected Points.
+ *
+ * Output of the [project](@ref project) pipeline: the points that survived clipping, in normalized device coordinates ([-1, 1]^3), and the index of each point in the input.
+ */
+struct Projected
+{
+    /// normalized device coordinates of the visible points
+    Points3 ndc;
+    /// index of each visible point in the input
+    std::vector<std::size_t> index;
+
+    // Methods
+    std::size_t size() const;
+};
+
+/**
+ * @brief View Frustum.
+ *
+ * The six clipping planes of a combined view-projection matrix (Gribb-Hartmann extraction).
+ * Each plane is stored as `Vec4(a, b, c, d)`, a point `p` lies on the inner side if `a*p.x + b*p.y + c*p.z + d >= 0`.
+ * The planes are not normalized, because only the sign of the distance is needed.
+ */
+struct Frustum
+{
+    /// number of planes: left, right, bottom, top, near, far
+    static const int size{ 6 };
+
+    /// the clipping planes
+    std::array<Vec4, size> planes;
+
+    // Constructors
+    Frustum(const Mat4&);
+
+    // Methods
+    bool contains(const Vec3&) const;
+    bool intersects(const Vec3& lo, const Vec3& hi) const;
+    bool intersects(const AABB3&) const;
+};
+
+// ----------------------------------------------
+// Batch Pipeline
+
+std::size_t project(const Mat4& viewProjection, const Points3& input, Projected& output);
+std::size_t cull(const Frustum&, const std::vector<Vec3>& lo, const std::vector<Vec3>& hi, std::vector<std::size_t>& visible);
+std::size_t cull(const Frustum&, const std::vector<AABB3>& boxes, std::vector<std::size_t>& visible);
+
+} /* vml */
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "Basics.h"
+#include "CSRGraph.h"
+#include "EdgeIndex.h"
 
 #include <vector>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 
 namespace vml {
@@ -20,7 +25,9 @@ namespace vml {
  * Dabei können optional mit `E` Daten wie eine Gewichtung an die Kante angehängt werden.
  * Diese Kanten werden in einer privaten Adjazenzliste `adjacencies` gespeichert.
  * `adjacencies` genauso viele Einträge wie `nodes`.
- * Jeder Knoten findet an seinem Index in `adjacencies` alle seine auswärtsdeutenden Kanten wieder, gespeichert als ein verpointerter `std::vector<Edge>`.
+ * Jeder Knoten findet an seinem Index in `adjacencies` alle seine auswärtsdeutenden Kanten wieder, gespeichert als ein verpointerter `EdgeList`.
+ * Die Kantenlisten und ihre Kanten werden aus einer [`std::pmr::memory_resource`](https://en.cppreference.com/w/cpp/memory/memory_resource) angelegt.
+ * Standardmäßig besitzt jeder Graph dafür eine eigene Arena (`std::pmr::monotonic_buffer_resource`), siehe [Konstruktoren](@ref Graph::Graph).
  * Die Kanten sind hier immer gerichtet. Um ungerichtete Kanten umzusetzt, können einfach zwei gerichtete Kanten erzeugt werden, die die zwei Knoten in beide Richtungen verbinden.
  * @tparam N Knotenklasse
  * @tparam E Kantendatenklasse
@@ -92,6 +99,13 @@ public:
 
     };
 
+    /**
+     * @brief Kantenliste.
+     *
+     * Ein `std::vector` von Kanten, dessen Speicher aus der Speicherressource des Graphen stammt.
+     */
+    typedef std::pmr::vector<Edge> EdgeList;
+
     /**
      * @brief Knotenliste.
      *
@@ -101,17 +115,88 @@ public:
     std::vector<N> nodes;
 
 
+    /**
+     * @name Konstruktoren
+     * @brief Wahl der Speicherressource.
+     */
+    ///@{
+    /**
+     * Standard:
+     * der Graph legt eine eigene monotone Arena an. Kantenlisten werden hintereinander in großen Blöcken angelegt statt einzeln auf dem Heap,
+     * und beim Löschen wird nur die Arena freigegeben (siehe [deletAllEdges](@ref deletAllEdges)).
+     * Da eine monotone Arena nichts einzeln freigibt, bleibt der alte Speicher einer gewachsenen Kantenliste bis dahin belegt.
+     */
+    Graph() :
+        arena{ std::make_unique<std::pmr::monotonic_buffer_resource>() },
+        resource{ arena.get() }
+    {}
+    /**
+     * Eigene Ressource:
+     * alle Kantenlisten werden aus `_resource` angelegt, z.B. einem `std::pmr::unsynchronized_pool_resource` für Graphen, deren Kantenlisten oft neu gebaut werden.
+     * Die Ressource muss länger leben als der Graph.
+     */
+    explicit Graph(std::pmr::memory_resource* _resource) :
+        resource{ _resource }
+    {}
+    ///@}
+
+    Graph(const Graph&) = delete;
+    Graph& operator = (const Graph&) = delete;
+
+    /// Verschiebekonstruktor, die Kantenlisten und die Arena wechseln den Besitzer. Der leere Graph `other` verwendet danach den globalen Heap.
+    Graph(Graph&& other) noexcept :
+        nodes{ std::move(other.nodes) },
+        adjacencies{ std::move(other.adjacencies) },
+        arena{ std::move(other.arena) },
+        resource{ other.resource },
+        index{ std::move(other.index) }
+    {
+        other.adjacencies.clear();
+        other.resource = std::pmr::new_delete_resource();
+    }
+
+    /// Verschiebezuweisung, die eigenen Kanten werden vorher gelöscht.
+    Graph& operator = (Graph&& other) noexcept
+    {
+        if (this == &other) return *this;
+        deletAllEdges();
+        nodes = std::move(other.nodes);
+        adjacencies = std::move(other.adjacencies);
+        arena = std::move(other.arena);
+        index = std::move(other.index);
+        resource = other.resource;
+        other.adjacencies.clear();
+        other.resource = std::pmr::new_delete_resource();
+        return *this;
+    }
+
     /**
      * @brief Destruktor.
      *
-     * Der Destruktor kümmert sich darum, dass alle verpointerten Kantenlisten in `adjacencies` gelöscht werden, um Datenlecks zu verhindern.
+     * Der Destruktor kümmert sich darum, dass alle Kantenlisten in `adjacencies` gelöscht werden, um Datenlecks zu verhindern (siehe [deletAllEdges](@ref deletAllEdges)).
      */
     ~Graph()
     {
-        for (std::vector<Edge>* e: adjacencies) delete e;
+        deletAllEdges();
+    }
+
+    /// Die Speicherressource der Kantenlisten.
+    std::pmr::memory_resource* memoryResource() const
+    {
+        return resource;
     }
 
 
+    /**
+     * @brief Anzahl der Knoten.
+     *
+     * Entspricht `nodes.size()`, dieselbe Funktion bietet [CSRGraph](@ref CSRGraph::size).
+     */
+    std::size_t size() const
+    {
+        return nodes.size();
+    }
+
     /**
      * @brief Verknüpft zwei Knoten mit einer Kante.
      *
@@ -123,7 +208,62 @@ public:
      */
     void link(Index parent, Index child, const E& data = E())
     {
-        edges(parent).emplace_back(parent, child, data);
+        EdgeList& elist{ edges(parent) };
+        if (index) index->insert(parent, child, elist.size());
+        elist.emplace_back(parent, child, data);
+    }
+
+    /**
+     * @brief Verknüpft zwei Knoten, falls sie noch nicht verknüpft sind.
+     *
+     * Wie [link](@ref link), aber ohne parallele Kanten. Mit [Index](@ref enableIndex) in erwartet konstanter Zeit, sonst linear im Grad von `parent`.
+     *
+     * @return `true`, wenn die Kante neu angelegt wurde
+     */
+    bool linkUnique(Index parent, Index child, const E& data = E())
+    {
+        if (hasEdge(parent, child)) return false;
+        link(parent, child, data);
+        return true;
+    }
+
+    /**
+     * @brief Entfernt eine Kante.
+     *
+     * Entfernt eine Kante von `parent` nach `child`, bei parallelen Kanten nur eine davon.
+     * Die letzte Kante von `parent` rückt dafür in die Lücke, die Reihenfolge der Kanten von `parent` ändert sich also.
+     * Mit [Index](@ref enableIndex) in erwartet konstanter Zeit, sonst linear im Grad von `parent`.
+     *
+     * @return `true`, wenn eine Kante entfernt wurde
+     */
+    bool unlink(Index parent, Index child)
+    {
+        if (parent >= adjacencies.size() || !adjacencies[parent]) return false;
+        EdgeList& elist{ *adjacencies[parent] };
+
+        // Position der Kante suchen
+        Index position{ NoN };
+        if (index)
+            position = index->find(parent, child);
+        else
+            for (Index k{0}; k < elist.size(); k++)
+                if (elist[k].child == child) { position = k; break; }
+        if (position == NoN) return false;
+
+        // letzte Kante in die Lücke schieben
+        const Index last{ elist.size() - 1 };
+        if (position != last)
+        {
+            std::swap(elist[position], elist[last]);
+            if (index) index->move(parent, elist[position].child, last, position);
+        }
+        elist.pop_back();
+
+        // bei parallelen Kanten eine verbleibende im Index eintragen
+        if (index && index->erase(parent, child) > 0)
+            for (Index k{0}; k < elist.size(); k++)
+                if (elist[k].child == child) { index->move(parent, child, position, k); break; }
+        return true;
     }
 
     /**
@@ -158,14 +298,14 @@ public:
      * die Adjazenzliste und Knotenlisten können syncronisiert werden.
      * Befindet sich an der gesuchten Stelle ein `nullptr` wird ein Pointer zu einer neuen Kantenliste dort gespeichert und die Refernz dazu zurückgegeben.
      */
-    std::vector<Edge>& edges(Index node)
+    EdgeList& edges(Index node)
     {
         // syncronisiere die Anzahl der Einträge von adjacencies und nodes
         sync();
         // prüfe ob der Knoten noch keine auswärtigen Kanten hat
         if (!adjacencies[node])
-            // erstelle eine neue leere Liste, deren Pointer in adjacencies gespeichert werden kann
-            adjacencies[node] = new std::vector<Edge>();
+            // erstelle eine neue leere Liste in der Speicherressource, deren Pointer in adjacencies gespeichert werden kann
+            adjacencies[node] = new (resource->allocate(sizeof(EdgeList), alignof(EdgeList))) EdgeList(resource);
         // now a refernce can be returned
         return *adjacencies[node];
     }
@@ -176,10 +316,10 @@ public:
      * Alle Knoten neuen Knoten werden, wie nullptr-Einträge behandelt, und es wird eine leere Liste zurück gegeben.
      * Da die leere Liste nicht in `adjacencies` gespeichert werden kann, wird eine statische Instanz einer leeren liste `empty` erstellt, welche als Refernze zurückgegeben werden kann.
      */
-    const std::vector<Edge>& edges(Index node) const
+    const EdgeList& edges(Index node) const
     {
         // kreiere eine statische Instanz einer leeren Kantenliste
-        static const std::vector<Edge> empty{};
+        static const EdgeList empty{};
 
         // prüfe ob der Index zu groß für adjacencies ist, trifft auch für nonode zu
         if (node >= adjacencies.size()) return empty;
@@ -192,11 +332,26 @@ public:
     ///@}
 
 
-	//@Todo: Docu
+    /**
+     * @brief Existiert eine Kante?
+     *
+     * Prüft, ob es eine Kante von `parent` nach `child` gibt. Mit [Index](@ref enableIndex) in erwartet konstanter Zeit, sonst wie [isEdge](@ref isEdge).
+     */
+    bool hasEdge(Index parent, Index child) const
+    {
+        if (index) return index->find(parent, child) != NoN;
+        return isEdge(parent, child);
+    }
+
+    /**
+     * @brief Existiert eine Kante? (linear)
+     *
+     * Durchsucht die Kanten von `parent` nach einer Kante zu `child`, ohne den [Index](@ref enableIndex) zu verwenden.
+     */
     bool isEdge(Index parent, Index child) const
     {
         // get reference to adjacencies of parent
-        const std::vector<Edge>& elist{ edges(parent) };
+        const EdgeList& elist{ edges(parent) };
         // create a lambda to find child
         auto is_child
         {
@@ -210,14 +365,60 @@ public:
     /**
      * @brief Kanten löschen.
      *
-     * Löschen die Pointer zu den Kanten listen die in der privaten Adjazenz liste gespeichert sind
+     * Löschen die Pointer zu den Kanten listen die in der privaten Adjazenz liste gespeichert sind.
+     * Mit der eigenen Arena und trivial zerstörbaren Kanten müssen die Listen nicht einzeln zerstört werden, dann wird nur die Arena freigegeben.
      */
     void deletAllEdges()
     {
-        // delete all Edge vector in adjacency list
-        for(auto evec : adjacencies) delete evec;
+        if (index) index->clear();
+        if (!(arena && std::is_trivially_destructible<Edge>::value))
+        {
+            // delete all Edge vector in adjacency list
+            for (EdgeList* evec : adjacencies)
+                if (evec)
+                {
+                    evec->~EdgeList();
+                    resource->deallocate(evec, sizeof(EdgeList), alignof(EdgeList));
+                }
+        }
         adjacencies.clear();
+        if (arena) arena->release();
+    }
+
+    /**
+     * @name Kantenindex
+     * @brief Optionaler Hash-Index der Kanten.
+     *
+     * Ein [EdgeIndex](@ref EdgeIndex) bildet `(parent, child)` auf die Position der Kante in der Kantenliste ab.
+     * Damit arbeiten [hasEdge](@ref hasEdge), [unlink](@ref unlink) und [linkUnique](@ref linkUnique) in erwartet konstanter Zeit statt linear im Grad des Knotens.
+     * Ohne Index kostet er nur einen leeren Pointer. [link](@ref link) und [unlink](@ref unlink) halten ihn aktuell;
+     * wer Kanten direkt über [edges](@ref edges) oder [forEachEdge](@ref forEachEdge) umhängt, muss ihn neu aufbauen.
+     */
+    ///@{
+    /// Baut den Index aus den vorhandenen Kanten auf.
+    void enableIndex()
+    {
+        index = std::make_unique<EdgeIndex>();
+        std::size_t count{ 0 };
+        for (const EdgeList* evec : adjacencies)
+            if (evec) count += evec->size();
+        index->reserve(count);
+        for (const EdgeList* evec : adjacencies)
+            if (evec)
+                for (Index k{0}; k < evec->size(); k++)
+                    index->insert((*evec)[k].parent, (*evec)[k].child, k);
+    }
+    /// Entfernt den Index und gibt seinen Speicher frei.
+    void disableIndex()
+    {
+        index.reset();
+    }
+    /// Ist der Index aktiv?
+    bool isIndexed() const
+    {
+        return static_cast<bool>(index);
     }
+    ///@}
 
     /**
      * @brief Unmittelbaren Nachbarknoten (Kinder).
@@ -234,6 +435,33 @@ public:
         return keys;
     }
 
+    /**
+     * @brief Einfrieren.
+     *
+     * Erstellt eine unveränderliche Kopie des Graphen in der kompakten [CSR-Form](@ref CSRGraph).
+     * Dort liegen die Kanten aller Knoten hintereinander in einem Array, sodass Traversierungen keine einzelnen Kantenlisten mehr verfolgen müssen.
+     * Die Reihenfolge der Kanten eines Knotens bleibt erhalten. Spätere Änderungen am Graphen wirken sich nicht auf die Kopie aus.
+     */
+    CSRGraph<N, E> freeze() const
+    {
+        const std::size_t n{ nodes.size() };
+        std::vector<Index> offsets(n + 1, 0);
+        for (Index i{0}; i < n; i++)
+            offsets[i+1] = offsets[i] + edges(i).size();
+
+        std::vector<Index> targets;
+        std::vector<E> values;
+        targets.reserve(offsets[n]);
+        values.reserve(offsets[n]);
+        for (Index i{0}; i < n; i++)
+            for (const Edge& e : edges(i))
+            {
+                targets.push_back(e.child);
+                values.push_back(e.data);
+            }
+        return CSRGraph<N, E>(nodes, std::move(offsets), std::move(targets), std::move(values));
+    }
+
     // ----------------------------------------------
     // Iterieren
 
@@ -248,20 +476,35 @@ public:
     ///@{
     void forEachEdge(const std::function<void(Edge&)>& predicate)
     {
-        for (std::vector<Edge>* evec : adjacencies)
+        for (EdgeList* evec : adjacencies)
             if (evec)
                 for (Edge& e : *evec)
                     predicate( e );
     }
     void forEachEdge(const std::function<void(const Edge&)>& predicate) const
     {
-        for (std::vector<Edge>* evec : adjacencies)
+        for (EdgeList* evec : adjacencies)
             if (evec)
                 for (Edge& e : *evec)
                     predicate( e );
     }
     ///@}
 
+    /**
+     * @brief Iteriere durch die Kinder eines Knotens.
+     *
+     * Ruft `predicate(child, data)` für jede auswärtige Kante von `parent` auf, ohne wie [children](@ref children) eine neue Liste anzulegen.
+     * Dieselbe Funktion bietet [CSRGraph](@ref CSRGraph::forEachChild), sodass Algorithmen beide Formen gleich behandeln können.
+     *
+     * @param parent Index des Elternknotens
+     * @param predicate Eine Lambda-Funktion, die den Index des Kindes und eine Referenz auf die Kanteninformation nimmt.
+     */
+    template<class F>
+    void forEachChild(Index parent, const F& predicate) const
+    {
+        for (const Edge& e : edges(parent)) predicate(e.child, e.data);
+    }
+
     /**
      * @brief Iteriere durch alle Knoten.
      *
@@ -289,7 +532,16 @@ private:
      * Durch die Pointer, wird müssen bei einem Resize kaum Daten herum geschoben werden.
      * Diese Datenstruktur dient nur der Graph internen Implementierung un muss von außerhalb nicht aufgerufen werden.
      */
-    std::vector< std::vector<Edge>* > adjacencies;
+    std::vector< EdgeList* > adjacencies;
+
+    /// eigene Arena, leer wenn eine fremde Speicherressource verwendet wird
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+
+    /// Speicherressource der Kantenlisten
+    std::pmr::memory_resource* resource;
+
+    /// optionaler Kantenindex, siehe [enableIndex](@ref enableIndex)
+    std::unique_ptr<EdgeIndex> index;
 
     /**
      * @brief Knoten und Adjazenzen syncronisieren.
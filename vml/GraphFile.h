@@ -0,0 +1,298 @@
+#pragma once
+
+#include "Basics.h"
+#include "CSRGraph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Read-Only Memory Mapped File.
+ *
+ * Maps a whole file into memory (`mmap` on POSIX systems). Pages are loaded by the operating system on first access and shared between processes,
+ * so opening even a large file takes constant time. Where memory mapping is not available the file is read into a buffer instead.
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator = (const MappedFile&) = delete;
+    MappedFile(MappedFile&&) noexcept;
+    MappedFile& operator = (MappedFile&&) noexcept;
+    ~MappedFile();
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const;
+    const char* data() const;
+    std::size_t size() const;
+
+private:
+    const char* begin;
+    std::size_t length;
+    /// `true` if `begin` is a mapping, `false` if it is the buffer
+    bool mapped;
+    /// fallback buffer, 8 byte aligned
+    std::vector<std::uint64_t> buffer;
+};
+
+/**
+ * @brief Header of a Binary Graph File.
+ *
+ * A graph file starts with this header, followed by the four arrays of a [CSRGraph](@ref CSRGraph) (nodes, row offsets, child indices, edge data) stored raw.
+ * Every array starts at a multiple of 64 bytes from the beginning of the file, so a mapped file can be used in place.
+ * The header records the version, the byte order and the sizes of the stored types; a file is only opened if all of them match the reading program.
+ */
+struct GraphFileHeader
+{
+    /// "VMLGRAPH"
+    char magic[8];
+    /// format version, see [GraphFileHeader::currentVersion](@ref currentVersion)
+    std::uint32_t version;
+    /// 0x01020304 in the byte order of the writer
+    std::uint32_t byteOrder;
+    /// `sizeof` of the index type, the node and the edge data type
+    std::uint64_t indexSize, nodeSize, edgeSize;
+    /// number of nodes and edges
+    std::uint64_t nodeCount, edgeCount;
+    /// byte offsets of the arrays from the start of the file
+    std::uint64_t nodesAt, offsetsAt, targetsAt, valuesAt;
+
+    static constexpr std::uint32_t currentVersion{ 1 };
+    static constexpr std::uint32_t order{ 0x01020304 };
+    static constexpr std::uint64_t alignment{ 64 };
+};
+
+/// Rounds `at` up to the [alignment](@ref GraphFileHeader::alignment) of the arrays.
+inline std::uint64_t alignSection(std::uint64_t at)
+{
+    return (at + GraphFileHeader::alignment - 1) / GraphFileHeader::alignment * GraphFileHeader::alignment;
+}
+
+// ----------------------------------------------
+// Writing
+
+/**
+ * @brief Writes a Graph File.
+ *
+ * Stores the graph in the binary format described at [GraphFileHeader](@ref GraphFileHeader). `N` and `E` are written raw,
+ * so they have to be trivially copyable and must not contain pointers. The file can be read with [MappedGraph](@ref MappedGraph).
+ *
+ * @return `false` if the file could not be written
+ */
+template<class N, class E>
+bool saveGraph(const CSRGraph<N, E>& graph, const std::string& path)
+{
+    static_assert(std::is_trivially_copyable<N>::value && std::is_trivially_copyable<E>::value, "graph files store nodes and edge data raw");
+    typedef typename CSRGraph<N, E>::Index Index;
+
+    GraphFileHeader header{};
+    std::memcpy(header.magic, "VMLGRAPH", 8);
+    header.version = GraphFileHeader::currentVersion;
+    header.byteOrder = GraphFileHeader::order;
+    header.indexSize = sizeof(Index);
+    header.nodeSize = sizeof(N);
+    header.edgeSize = sizeof(E);
+    header.nodeCount = graph.size();
+    header.edgeCount = graph.edgeCount();
+    header.nodesAt = alignSection(sizeof(GraphFileHeader));
+    header.offsetsAt = alignSection(header.nodesAt + sizeof(N) * header.nodeCount);
+    header.targetsAt = alignSection(header.offsetsAt + sizeof(Index) * (header.nodeCount + 1));
+    header.valuesAt = alignSection(header.targetsAt + sizeof(Index) * header.edgeCount);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    std::uint64_t at{ 0 };
+    // writes `bytes` at the file offset `to`, padded with zeros
+    const auto write{ [&](std::uint64_t to, const void* data, std::uint64_t bytes)
+    {
+        static const char zeros[GraphFileHeader::alignment]{};
+        file.write(zeros, static_cast<std::streamsize>(to - at));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        at = to + bytes;
+    } };
+    write(0, &header, sizeof(header));
+    write(header.nodesAt, graph.nodes().data(), sizeof(N) * header.nodeCount);
+    write(header.offsetsAt, graph.rowOffsets().data(), sizeof(Index) * (header.nodeCount + 1));
+    write(header.targetsAt, graph.childIndices().data(), sizeof(Index) * header.edgeCount);
+    write(header.valuesAt, graph.edgeData().data(), sizeof(E) * header.edgeCount);
+    return static_cast<bool>(file.flush());
+}
+
+// ----------------------------------------------
+// Reading
+
+/**
+ * @class MappedGraph
+ * @brief Graph File used in Place.
+ *
+ * Maps a file written by [saveGraph](@ref saveGraph) and reads the arrays directly from the mapping, nothing is parsed or copied.
+ * Opening checks the header and the array bounds, which takes constant time; the row offsets and the child indices are trusted.
+ * For files that may be corrupt or edited by hand, [validate](@ref validate) checks them in linear time, before any access reads out of bounds.
+ * The interface matches the read access of [CSRGraph](@ref CSRGraph), so the [searches](@ref bfs) run on it unchanged.
+ * [load](@ref load) copies the graph into an owning `CSRGraph` when it has to outlive the file.
+ *
+ * @tparam N node class, trivially copyable
+ * @tparam E edge data class, trivially copyable
+ */
+template<class N, class E = char>
+class MappedGraph
+{
+public:
+    typedef std::size_t Index;
+    static constexpr Index NoN{ static_cast<Index>(-1) };
+
+    static_assert(std::is_trivially_copyable<N>::value && std::is_trivially_copyable<E>::value, "graph files store nodes and edge data raw");
+
+    /// Closed graph without nodes.
+    MappedGraph() : header{}, vertices{ nullptr }, offsets{ &zero }, targets{ nullptr }, values{ nullptr }
+    {}
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator = (const MappedGraph&) = delete;
+
+    /**
+     * @brief Opens a Graph File.
+     *
+     * Only the header, the array bounds and the first and last row offset are checked, see [validate](@ref validate) for a full check.
+     *
+     * @return `false` if the file can not be read, is not a graph file, has another version, byte order or type sizes, or is truncated.
+     * The graph is empty then.
+     */
+    bool open(const std::string& path)
+    {
+        close();
+        if (!file.open(path)) return false;
+        if (!check())
+        {
+            close();
+            return false;
+        }
+        const char* base{ file.data() };
+        vertices = reinterpret_cast<const N*>(base + header.nodesAt);
+        offsets = reinterpret_cast<const Index*>(base + header.offsetsAt);
+        targets = reinterpret_cast<const Index*>(base + header.targetsAt);
+        values = reinterpret_cast<const E*>(base + header.valuesAt);
+        return true;
+    }
+
+    /// Unmaps the file, the graph is empty afterwards.
+    void close()
+    {
+        file.close();
+        header = GraphFileHeader{};
+        vertices = nullptr;
+        offsets = &zero;
+        targets = nullptr;
+        values = nullptr;
+    }
+
+    bool isOpen() const { return file.isOpen(); }
+
+    /**
+     * @brief Full Consistency Check.
+     *
+     * Checks in `O(n + m)` that the row offsets start at 0, never decrease and end at the number of edges, and that every child index is a node.
+     * Only then [children](@ref children), [forEachChild](@ref forEachChild) and the searches stay inside the mapping. A closed graph is valid.
+     */
+    bool validate() const
+    {
+        const Index n{ size() }, m{ edgeCount() };
+        if (offsets[0] != 0 || offsets[n] != m) return false;
+        for (Index i{0}; i < n; i++)
+            if (offsets[i] > offsets[i+1]) return false;
+        for (Index k{0}; k < m; k++)
+            if (targets[k] >= n) return false;
+        return true;
+    }
+
+    // ----------------------------------------------
+    // Size
+
+    /// Number of nodes.
+    std::size_t size() const { return static_cast<std::size_t>(header.nodeCount); }
+    /// Number of edges.
+    std::size_t edgeCount() const { return static_cast<std::size_t>(header.edgeCount); }
+    /// Number of outgoing edges of `node`.
+    std::size_t degree(Index node) const { return offsets[node+1] - offsets[node]; }
+
+    // ----------------------------------------------
+    // Access
+
+    /// The node at `index`.
+    const N& node(Index index) const { return vertices[index]; }
+    /// Indices of the children of `parent`.
+    Range<Index> children(Index parent) const { return Range<Index>{ targets + offsets[parent], targets + offsets[parent+1] }; }
+    /// Data of the outgoing edges of `parent`, in the same order as [children](@ref children).
+    Range<E> data(Index parent) const { return Range<E>{ values + offsets[parent], values + offsets[parent+1] }; }
+
+    /// Checks for an edge from `parent` to `child` by scanning the edges of `parent`.
+    bool isEdge(Index parent, Index child) const
+    {
+        if (parent >= size()) return false;
+        for (const Index c : children(parent))
+            if (c == child) return true;
+        return false;
+    }
+
+    /// Calls `predicate(child, data)` for every outgoing edge of `parent`.
+    template<class F>
+    void forEachChild(Index parent, const F& predicate) const
+    {
+        for (Index k{ offsets[parent] }; k < offsets[parent+1]; k++) predicate(targets[k], values[k]);
+    }
+
+    /// Copies the graph into an owning [CSRGraph](@ref CSRGraph).
+    CSRGraph<N, E> load() const
+    {
+        return CSRGraph<N, E>(std::vector<N>(vertices, vertices + size()),
+                              std::vector<Index>(offsets, offsets + size() + 1),
+                              std::vector<Index>(targets, targets + edgeCount()),
+                              std::vector<E>(values, values + edgeCount()));
+    }
+
+private:
+    /// Validates the header against the file size and the types of this program.
+    bool check()
+    {
+        if (file.size() < sizeof(GraphFileHeader)) return false;
+        std::memcpy(&header, file.data(), sizeof(GraphFileHeader));
+        if (std::memcmp(header.magic, "VMLGRAPH", 8) != 0) return false;
+        if (header.version != GraphFileHeader::currentVersion || header.byteOrder != GraphFileHeader::order) return false;
+        if (header.indexSize != sizeof(Index) || header.nodeSize != sizeof(N) || header.edgeSize != sizeof(E)) return false;
+
+        // every array lies inside the file and is aligned for its type
+        const std::uint64_t size{ file.size() }, n{ header.nodeCount }, m{ header.edgeCount };
+        const auto fits{ [&](std::uint64_t at, std::uint64_t count, std::uint64_t bytes, std::uint64_t align)
+        {
+            const std::uintptr_t address{ reinterpret_cast<std::uintptr_t>(file.data()) + static_cast<std::uintptr_t>(at) };
+            return at <= size && (bytes == 0 || count <= (size - at) / bytes) && address % align == 0;
+        } };
+        if (n >= static_cast<std::uint64_t>(NoN)) return false;
+        if (!fits(header.nodesAt, n, sizeof(N), alignof(N)) || !fits(header.offsetsAt, n + 1, sizeof(Index), alignof(Index)) ||
+            !fits(header.targetsAt, m, sizeof(Index), alignof(Index)) || !fits(header.valuesAt, m, sizeof(E), alignof(E))) return false;
+
+        const Index* rows{ reinterpret_cast<const Index*>(file.data() + header.offsetsAt) };
+        return rows[0] == 0 && rows[n] == m;
+    }
+
+    MappedFile file;
+    GraphFileHeader header;
+    /// arrays inside the mapping
+    const N* vertices;
+    const Index* offsets;
+    const Index* targets;
+    const E* values;
+    /// row offsets of the empty graph
+    Index zero{ 0 };
+};
+
+} /* vml */
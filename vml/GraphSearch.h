@@ -0,0 +1,340 @@
+#pragma once
+
+#include "Basics.h"
+
+#include <algorithm> // std::fill, std::reverse
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief D-ary Heap.
+ *
+ * Min-heap of `(key, node)` pairs with `D` children per element. Compared to a binary heap the tree is flatter,
+ * so a push needs fewer comparisons and a pop touches neighbouring memory, which suits the many pushes of shortest path searches.
+ * Keys are not decreased in place: a search pushes a node again with its smaller key and skips outdated entries when they are popped.
+ */
+template<class K, std::size_t D = 4>
+class DaryHeap
+{
+public:
+    typedef std::pair<K, std::size_t> Item;
+
+    bool empty() const { return items.empty(); }
+    std::size_t size() const { return items.size(); }
+    void clear() { items.clear(); }
+    /// The item with the smallest key.
+    const Item& top() const { return items.front(); }
+
+    /// Inserts `node` with the priority `key`.
+    void push(const K& key, std::size_t node)
+    {
+        std::size_t i{ items.size() };
+        items.emplace_back(key, node);
+        while (i > 0)
+        {
+            const std::size_t parent{ (i - 1) / D };
+            if (!(items[i].first < items[parent].first)) break;
+            std::swap(items[i], items[parent]);
+            i = parent;
+        }
+    }
+
+    /// Removes the item with the smallest key.
+    void pop()
+    {
+        items.front() = items.back();
+        items.pop_back();
+        const std::size_t n{ items.size() };
+        std::size_t i{ 0 };
+        for (;;)
+        {
+            const std::size_t first{ D * i + 1 };
+            if (first >= n) break;
+            const std::size_t last{ (first + D < n) ? first + D : n };
+            std::size_t best{ first };
+            for (std::size_t c{first + 1}; c < last; c++)
+                if (items[c].first < items[best].first) best = c;
+            if (!(items[best].first < items[i].first)) break;
+            std::swap(items[i], items[best]);
+            i = best;
+        }
+    }
+
+private:
+    std::vector<Item> items;
+};
+
+/**
+ * @brief Reusable Search State.
+ *
+ * Holds the per node arrays of the graph searches (visited marks, distances, parents) and their queues, so repeated queries on the same graph do not allocate.
+ * Visited marks are generation stamps: starting a new search only increments the generation instead of clearing the arrays,
+ * the arrays are only touched for the nodes a search actually reaches. Distances and parents are only valid for [visited](@ref visited) nodes.
+ * A weighted search that stops early at its target also marks the nodes it only reached as visited, their distances and parents are tentative:
+ * final are only the values of the nodes taken from the queue before the target, and of the target itself.
+ * A workspace can be used with graphs of different sizes, it grows when needed. It must not be shared between threads.
+ *
+ * @tparam W distance type of the weighted searches
+ */
+template<class W = double>
+class SearchWorkspace
+{
+public:
+    typedef std::size_t Index;
+    static constexpr Index NoN{ static_cast<Index>(-1) };
+
+    /// Starts a new search on a graph with `n` nodes, all nodes become unvisited.
+    void reset(std::size_t n)
+    {
+        if (stamps.size() < n)
+        {
+            stamps.resize(n, 0);
+            distances.resize(n);
+            parents.resize(n);
+        }
+        if (++generation == 0)
+        {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            generation = 1;
+        }
+        queue.clear();
+        heap.clear();
+    }
+
+    /// Was `node` reached by the last search?
+    bool visited(Index node) const { return node < stamps.size() && stamps[node] == generation; }
+    /// Distance of a visited node from the source: the number of edges for [bfs](@ref bfs) and [dfs](@ref dfs), the summed weights otherwise (possibly tentative, see above).
+    W distance(Index node) const { return distances[node]; }
+    /// Predecessor of a visited node on its search path, `NoN` for the source.
+    Index parent(Index node) const { return parents[node]; }
+
+    /**
+     * @brief Path to a Node.
+     *
+     * Follows the parents from `target` back to the source and writes the nodes from the source to `target` into `path`.
+     * The path is empty if `target` was not reached.
+     */
+    void path(Index target, std::vector<Index>& path) const
+    {
+        path.clear();
+        if (!visited(target)) return;
+        for (Index n{ target }; n != NoN; n = parents[n]) path.push_back(n);
+        std::reverse(path.begin(), path.end());
+    }
+
+    /// Marks `node` as visited with its distance and parent.
+    void visit(Index node, const W& distance, Index parent)
+    {
+        stamps[node] = generation;
+        distances[node] = distance;
+        parents[node] = parent;
+    }
+
+    /// node queue or stack of the unweighted searches, in-degrees of the topological sort
+    std::vector<Index> queue;
+    /// priority queue of the weighted searches
+    DaryHeap<W> heap;
+
+private:
+    /// generation of every node's last visit
+    std::vector<std::uint32_t> stamps;
+    /// current generation
+    std::uint32_t generation{ 0 };
+    /// distance of every visited node
+    std::vector<W> distances;
+    /// parent of every visited node
+    std::vector<Index> parents;
+};
+
+// ----------------------------------------------
+// Unweighted Searches
+
+/**
+ * @brief Breadth First Search.
+ *
+ * Visits all nodes reachable from `source` in the order of their number of edges from the source and calls `visit(node, depth)` for each.
+ * Works on [Graph](@ref Graph) and [CSRGraph](@ref CSRGraph) alike. Afterwards the workspace holds the depths and the parents of a shortest path tree.
+ *
+ * @return number of visited nodes
+ */
+template<class G, class W, class F>
+std::size_t bfs(const G& graph, std::size_t source, SearchWorkspace<W>& ws, const F& visit)
+{
+    ws.reset(graph.size());
+    ws.visit(source, W(0), SearchWorkspace<W>::NoN);
+    ws.queue.push_back(source);
+    for (std::size_t head{0}; head < ws.queue.size(); head++)
+    {
+        const std::size_t node{ ws.queue[head] };
+        const W depth{ ws.distance(node) };
+        visit(node, depth);
+        graph.forEachChild(node, [&](std::size_t child, const auto&)
+        {
+            if (ws.visited(child)) return;
+            ws.visit(child, depth + W(1), node);
+            ws.queue.push_back(child);
+        });
+    }
+    return ws.queue.size();
+}
+
+/// Breadth first search without a callback.
+template<class G, class W>
+std::size_t bfs(const G& graph, std::size_t source, SearchWorkspace<W>& ws)
+{
+    return bfs(graph, source, ws, [](std::size_t, const W&) {});
+}
+
+/**
+ * @brief Depth First Search.
+ *
+ * Visits all nodes reachable from `source` in preorder and calls `visit(node, depth)` for each. Children are explored in the order of their edges.
+ * The search uses an explicit stack, so it does not overflow the call stack on long paths.
+ * Afterwards the workspace holds the depths in and the parents of the depth first tree.
+ *
+ * @return number of visited nodes
+ */
+template<class G, class W, class F>
+std::size_t dfs(const G& graph, std::size_t source, SearchWorkspace<W>& ws, const F& visit)
+{
+    typedef std::size_t Index;
+    ws.reset(graph.size());
+    std::size_t count{ 0 };
+    // the stack holds (node, parent) pairs, a node is visited when it is popped the first time
+    ws.queue.push_back(source);
+    ws.queue.push_back(SearchWorkspace<W>::NoN);
+    while (!ws.queue.empty())
+    {
+        const Index parent{ ws.queue.back() }; ws.queue.pop_back();
+        const Index node{ ws.queue.back() }; ws.queue.pop_back();
+        if (ws.visited(node)) continue;
+        const W depth{ (parent == SearchWorkspace<W>::NoN) ? W(0) : ws.distance(parent) + W(1) };
+        ws.visit(node, depth, parent);
+        visit(node, depth);
+        count++;
+
+        // push the children in reverse, so the first child is explored first
+        const std::size_t top{ ws.queue.size() };
+        graph.forEachChild(node, [&](Index child, const auto&)
+        {
+            if (ws.visited(child)) return;
+            ws.queue.push_back(child);
+            ws.queue.push_back(node);
+        });
+        for (std::size_t a{top}, b{ws.queue.size()}; a + 2 < b; a += 2, b -= 2)
+        {
+            std::swap(ws.queue[a], ws.queue[b-2]);
+            std::swap(ws.queue[a+1], ws.queue[b-1]);
+        }
+    }
+    return count;
+}
+
+/// Depth first search without a callback.
+template<class G, class W>
+std::size_t dfs(const G& graph, std::size_t source, SearchWorkspace<W>& ws)
+{
+    return dfs(graph, source, ws, [](std::size_t, const W&) {});
+}
+
+// ----------------------------------------------
+// Shortest Paths
+
+/**
+ * @brief A* Search.
+ *
+ * Shortest path from `source` to `target` with the edge weights `weight(data)`, which have to be non-negative.
+ * Nodes are expanded in the order of their distance plus `heuristic(node)`, an estimate of the remaining distance to `target`.
+ * If the heuristic never overestimates, the found path is a shortest one. A [d-ary heap](@ref DaryHeap) with lazy deletion serves as priority queue.
+ * Afterwards the [path](@ref SearchWorkspace::path) to `target` can be read from the workspace. The search stops as soon as `target` is taken from the queue,
+ * so the other visited nodes may only hold tentative distances and parents.
+ *
+ * @param target node to stop at, `NoN` searches the whole reachable graph
+ * @return `true` if `target` was reached (for `NoN`: always)
+ */
+template<class G, class W, class Weight, class Heuristic>
+bool astar(const G& graph, std::size_t source, std::size_t target, SearchWorkspace<W>& ws, const Weight& weight, const Heuristic& heuristic)
+{
+    typedef std::size_t Index;
+    ws.reset(graph.size());
+    ws.visit(source, W(0), SearchWorkspace<W>::NoN);
+    ws.heap.push(heuristic(source), source);
+    while (!ws.heap.empty())
+    {
+        const Index node{ ws.heap.top().second };
+        const W key{ ws.heap.top().first };
+        ws.heap.pop();
+        const W dist{ ws.distance(node) };
+        // outdated entry, the node was pushed again with a smaller distance
+        if (dist + heuristic(node) < key) continue;
+        if (node == target) return true;
+
+        graph.forEachChild(node, [&](Index child, const auto& data)
+        {
+            const W d{ dist + weight(data) };
+            if (ws.visited(child) && !(d < ws.distance(child))) return;
+            ws.visit(child, d, node);
+            ws.heap.push(d + heuristic(child), child);
+        });
+    }
+    return target == SearchWorkspace<W>::NoN;
+}
+
+/**
+ * @brief Dijkstra's Algorithm.
+ *
+ * Shortest paths from `source` with the non-negative edge weights `weight(data)`, i.e. [A*](@ref astar) without heuristic.
+ * With `target = NoN` the workspace afterwards holds the distances and the shortest path tree of all reachable nodes.
+ * With a target the search stops when it is settled, then the values are final only for the nodes taken from the queue before `target` and for `target` itself,
+ * the other visited nodes were only reached and keep tentative values.
+ *
+ * @param target node to stop at, `NoN` computes the distances to all reachable nodes
+ * @return `true` if `target` was reached (for `NoN`: always)
+ */
+template<class G, class W, class Weight>
+bool dijkstra(const G& graph, std::size_t source, std::size_t target, SearchWorkspace<W>& ws, const Weight& weight)
+{
+    return astar(graph, source, target, ws, weight, [](std::size_t) { return W(0); });
+}
+
+// ----------------------------------------------
+// Ordering
+
+/**
+ * @brief Topological Sort.
+ *
+ * Orders the nodes so that every edge points from an earlier to a later node (Kahn's algorithm, linear in the size of the graph).
+ * Nodes without incoming edges are taken in index order.
+ *
+ * @param [out] order all nodes in topological order, only the acyclic part if the graph has a cycle
+ * @return `false` if the graph has a cycle
+ */
+template<class G, class W>
+bool topologicalSort(const G& graph, std::vector<std::size_t>& order, SearchWorkspace<W>& ws)
+{
+    typedef std::size_t Index;
+    const std::size_t n{ graph.size() };
+    ws.reset(n);
+    // in-degrees
+    std::vector<Index>& degree{ ws.queue };
+    degree.assign(n, 0);
+    for (Index i{0}; i < n; i++)
+        graph.forEachChild(i, [&](Index child, const auto&) { degree[child]++; });
+
+    order.clear();
+    order.reserve(n);
+    for (Index i{0}; i < n; i++)
+        if (degree[i] == 0) order.push_back(i);
+    for (std::size_t head{0}; head < order.size(); head++)
+        graph.forEachChild(order[head], [&](Index child, const auto&)
+        {
+            if (--degree[child] == 0) order.push_back(child);
+        });
+    return order.size() == n;
+}
+
+} /* vml */
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Arc.h"
+#include "ArcShape.h"
+
+#include <vector>
+
+namespace vml {
+
+// ----------------------------------------------
+// Exact Intersection Kernels
+
+int intersect(const Arc&, const Arc&, Vec2 points[2]);
+int intersect(const Arc&, const Vec2& p, const Vec2& q, Vec2 points[2]);
+
+// ----------------------------------------------
+// Shape Overlap
+
+bool overlaps(const ArcShape&, const ArcShape&);
+std::size_t overlaps(const ArcShape& shape, const std::vector<ArcShape>& others, std::vector<std::size_t>& hits);
+
+} /* vml */
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec.h"
+
+namespace vml {
+
+/**
+ * @brief Generic Fixed Size Matrix.
+ *
+ * `Mat<T, R, C>` is a matrix with `R` rows and `C` columns of type `T`.
+ * The entries are stored row by row (row-major) in `data`, the same layout as [Mat4](@ref Mat4): `at(row, col) = data[row*C + col]`.
+ * [Mat4](@ref Mat4) is a thin wrapper of `Mat<Float, 4, 4>`.
+ *
+ * @tparam T entry type
+ * @tparam R number of rows
+ * @tparam C number of columns
+ */
+template<typename T, int R, int C>
+struct Mat
+{
+    static_assert(R > 0 && C > 0, "Mat needs at least one entry.");
+
+    /// entry type
+    using value_type = T;
+    /// number of rows
+    static constexpr int rows{ R };
+    /// number of columns
+    static constexpr int cols{ C };
+    /// number of entries
+    static constexpr int size{ R * C };
+
+    /// the entries, row-major
+    T data[R * C];
+
+    // Constructors
+
+    /// Diagonal Constructor: `d` on the main diagonal, all other entries are 0.
+    explicit Mat(T d) : data{}
+    {
+        for (int i{0}; i < ((R < C) ? R : C); i++) at(i, i) = d;
+    }
+
+    /// Identity (Default Constructor), like Mat4.
+    Mat() : Mat(T(1))
+    {}
+
+    /// Row Constructor: one vector per row.
+    template<typename... Rows, typename = std::enable_if_t<(sizeof...(Rows) == R) && (R > 1)>>
+    Mat(const Rows&... rowVectors)
+    {
+        const Vec<T, C> rv[R]{ rowVectors... };
+        for (int row{0}; row < R; row++)
+            for (int col{0}; col < C; col++) at(row, col) = rv[row][col];
+    }
+
+    // Access to entries
+    T& operator[] (int i) { return data[i]; }
+    const T& operator[] (int i) const { return data[i]; }
+    T& at(int row, int col) { return data[row * C + col]; }
+    const T& at(int row, int col) const { return data[row * C + col]; }
+
+    /// Row Access: copies the entries of a row into a vector.
+    Vec<T, C> row(int i) const
+    {
+        Vec<T, C> v;
+        for (int col{0}; col < C; col++) v[col] = at(i, col);
+        return v;
+    }
+
+    /// Column Access: copies the entries of a column into a vector.
+    Vec<T, R> col(int i) const
+    {
+        Vec<T, R> v;
+        for (int row{0}; row < R; row++) v[row] = at(row, i);
+        return v;
+    }
+
+    /// Transposed Matrix: rows become columns.
+    Mat<T, C, R> transposed() const
+    {
+        Mat<T, C, R> M{ T(0) };
+        for (int row{0}; row < R; row++)
+            for (int col{0}; col < C; col++) M.at(col, row) = at(row, col);
+        return M;
+    }
+};
+
+// ----------------------------------------------
+// Namespace Methods
+
+/**
+ * @brief Matrix Operators.
+ *
+ * Element wise sum and difference, scaling by a scalar, matrix-matrix and matrix-vector product.
+ * The matrix-vector product accepts vector expressions, which are evaluated once into a temporary before the product.
+ */
+///@{
+template<typename T, int R, int C>
+Mat<T, R, C> operator + (const Mat<T, R, C>& a, const Mat<T, R, C>& b)
+{
+    Mat<T, R, C> M{ T(0) };
+    for (int i{0}; i < R*C; i++) M[i] = a[i] + b[i];
+    return M;
+}
+template<typename T, int R, int C>
+Mat<T, R, C> operator - (const Mat<T, R, C>& a, const Mat<T, R, C>& b)
+{
+    Mat<T, R, C> M{ T(0) };
+    for (int i{0}; i < R*C; i++) M[i] = a[i] - b[i];
+    return M;
+}
+template<typename T, int R, int C>
+Mat<T, R, C> operator * (const Mat<T, R, C>& a, T factor)
+{
+    Mat<T, R, C> M{ T(0) };
+    for (int i{0}; i < R*C; i++) M[i] = a[i] * factor;
+    return M;
+}
+template<typename T, int R, int C>
+Mat<T, R, C> operator * (T factor, const Mat<T, R, C>& a)
+{
+    return a * factor;
+}
+template<typename T, int R, int K, int C>
+Mat<T, R, C> operator * (const Mat<T, R, K>& a, const Mat<T, K, C>& b)
+{
+    Mat<T, R, C> M{ T(0) };
+    for (int row{0}; row < R; row++)
+        for (int k{0}; k < K; k++)
+        {
+            const T ark{ a.at(row, k) };
+            for (int col{0}; col < C; col++) M.at(row, col) += ark * b.at(k, col);
+        }
+    return M;
+}
+template<typename T, int R, int C, typename E>
+Vec<T, R> operator * (const Mat<T, R, C>& m, const VecExpr<E>& expr)
+{
+    static_assert(E::size == C, "Matrix and vector dimensions do not match.");
+    const Vec<T, C> v{ expr };
+    Vec<T, R> u;
+    for (int row{0}; row < R; row++)
+    {
+        T sum{ 0 };
+        for (int col{0}; col < C; col++) sum += m.at(row, col) * v[col];
+        u[row] = sum;
+    }
+    return u;
+}
+///@}
+
+/**
+ * @brief Print Overload.
+ *
+ * Prints the entries row by row, in the same format as Mat4.
+ */
+template<typename T, int R, int C>
+std::ostream& operator << (std::ostream& os, const Mat<T, R, C>& m)
+{
+    os << "(";
+    for (int row{0}; row < R; row++)
+    {
+        os << "\t";
+        for (int col{0}; col < C; col++) os << m.at(row, col) << ((col < C-1) ? "," : "");
+        os << ((row < R-1) ? "" : "\t)") << "\n";
+    }
+    return os;
+}
+
+// ----------------------------------------------
+// Aliases
+
+using Mat2f = Mat<float, 2, 2>;
+using Mat3f = Mat<float, 3, 3>;
+using Mat4f = Mat<float, 4, 4>;
+using Mat2d = Mat<double, 2, 2>;
+using Mat3d = Mat<double, 3, 3>;
+using Mat4d = Mat<double, 4, 4>;
+
+} /* namespace vml */
@@ -4,6 +4,7 @@
 #include "parse.h"
 #include "Vec3.h"
 #include "Vec4.h"
+#include "Mat.h"
 
 namespace vml {
 
@@ -13,10 +14,12 @@ namespace vml {
  * Mat4 ist eine Implementierung einer 4x4 Matrix.
  * Die Matrix kann affine Transformationen (Rotation, Verschiebung, Skalierung, ect) im dreidimensionalen Raum beschrieben.
  * Sie eignet sich zum Verwenden mit OpenGL.
- * Intern ist sind die Einträge als eine c-Style array gespeichert.
- * @Todo: matmul, transpose, det
+ * Intern ist sind die Einträge als eine c-Style array gespeichert, Zeile für Zeile (row-major): `at(row, col) = M[row*4 + col]`.
+ * Für OpenGL (column-major) muss die Matrix deshalb mit `transpose = GL_TRUE` hochgeladen werden.
+ * Mat4 ist eine dünne Hülle um [Mat<Float, 4, 4>](@ref Mat), von der sie den Datenspeicher, die Indizierung, `at` und `transposed` übernimmt.
+ * @Todo: det
  */
-struct Mat4
+struct Mat4 : Mat<Float, 4, 4>
 {
     /// Anzahl der Vec4-Vektor pro Matrix, bzw. Anzahl der Reihen oder Spalten
     static const int vSize {  4 };
@@ -25,30 +28,24 @@ struct Mat4
     
     // Konstruktoren
     Mat4(const Vec4&, const Vec4&, const Vec4&, const Vec4&);
+    Mat4(const Mat<Float, 4, 4>&);
     Mat4(Float);
     Mat4();
     
     // Zugang zu Einträgen
     Float* data();
-    Float& operator[] (int i);
-    const Float& operator[] (int i) const;
-    Float& at(int, int);
-    Float at(int, int) const;
     Vec4 row(int i) const;
     Vec4 col(int i) const;
     
     // Methoden
-//    Mat4 transposed() const;
 //    Float det() const;
-    
-private:
-    /// Interner Datenspeicher der Matrix: c-Style array
-    Float M[fSize];
 };
 
 // ----------------------------------------------
 // Operatoren
 
+Mat4 operator * (const Mat4&, const Mat4&);
+Vec4 operator * (const Mat4&, const Vec4&);
 std::ostream& operator << (std::ostream&, const Mat4&);
 
 // ----------------------------------------------
@@ -56,6 +53,7 @@ std::ostream& operator << (std::ostream&, const Mat4&);
 
 Mat4 lookAt(const Vec3&, const Vec3&, const Vec3&);
 Mat4 ortho(Float left, Float right, Float bottom, Float top, Float nearVal, Float farVal);
+Mat4 perspective(Float fovy, Float aspect, Float nearVal, Float farVal);
 
 // ----------------------------------------------
 // Parsing
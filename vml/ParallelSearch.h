@@ -0,0 +1,357 @@
+#pragma once
+
+#include "Basics.h"
+#include "CSRGraph.h"
+#include "parallel.h"
+
+#include <algorithm> // std::max, std::min
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Atomic Bitmap.
+ *
+ * One bit per node in 64 bit words that can be set concurrently. Used for the visited set and the frontiers of [parallelBfs](@ref parallelBfs).
+ */
+class AtomicBitmap
+{
+public:
+    /// Bitmap of `n` cleared bits.
+    explicit AtomicBitmap(std::size_t n = 0) : count{ (n + 63) / 64 }, words{ new std::atomic<std::uint64_t>[(n + 63) / 64] }
+    {
+        clear();
+    }
+
+    /// Number of words.
+    std::size_t size() const { return count; }
+
+    /// Clears all bits.
+    void clear()
+    {
+        for (std::size_t w{0}; w < count; w++) words[w].store(0, std::memory_order_relaxed);
+    }
+
+    bool test(std::size_t i) const
+    {
+        return (words[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1u;
+    }
+
+    /// Sets bit `i` and returns `true` if this call changed it, i.e. exactly one of several concurrent callers wins.
+    bool claim(std::size_t i)
+    {
+        const std::uint64_t bit{ std::uint64_t{1} << (i & 63) };
+        if (words[i >> 6].load(std::memory_order_relaxed) & bit) return false;
+        return !(words[i >> 6].fetch_or(bit, std::memory_order_relaxed) & bit);
+    }
+
+    /// Sets bit `i` without synchronization, only for words no other thread writes.
+    void set(std::size_t i)
+    {
+        words[i >> 6].store(words[i >> 6].load(std::memory_order_relaxed) | (std::uint64_t{1} << (i & 63)), std::memory_order_relaxed);
+    }
+
+    std::uint64_t word(std::size_t w) const { return words[w].load(std::memory_order_relaxed); }
+
+private:
+    std::size_t count;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> words;
+};
+
+// ----------------------------------------------
+// Breadth First Search
+
+/**
+ * @brief Parallel Direction-Optimizing Breadth First Search.
+ *
+ * Level synchronous BFS from `source` that chooses per level between two strategies (Beamer et al.):
+ * - top-down: the threads split the frontier (a list of nodes) and claim the unvisited children with an atomic `fetch_or` on the visited bitmap,
+ * - bottom-up: the threads split the unvisited nodes into blocks of 64 and check, whether any parent lies in the frontier (a bitmap).
+ *   Each thread writes only the bitmap words of its own block, a node stops at its first parent found.
+ *
+ * Top-down is cheap for small frontiers, bottom-up for large ones, where most edges would hit visited nodes anyway.
+ * The search switches to bottom-up when the edges of the frontier exceed `1/alpha` of the edges of the unvisited nodes,
+ * and back to top-down when the frontier shrinks below `1/beta` of all nodes.
+ * On a graph, where every edge exists in both directions, `transposed` can be the graph itself.
+ *
+ * @param graph the graph, a [Graph](@ref Graph) has to be [frozen](@ref Graph::freeze) first
+ * @param transposed the [reversed](@ref CSRGraph::transpose) graph
+ * @param source start node
+ * @param [out] depths number of edges from the source, `NoN` for unreached nodes
+ * @param [out] parents parent in a BFS tree, `NoN` for the source and unreached nodes
+ * @param grain minimal number of nodes per thread and level
+ * @return number of reached nodes
+ */
+template<class N, class E>
+std::size_t parallelBfs(const CSRGraph<N, E>& graph, const CSRGraph<N, E>& transposed, std::size_t source,
+                        std::vector<std::size_t>& depths, std::vector<std::size_t>& parents, std::size_t grain = 1 << 10)
+{
+    typedef std::size_t Index;
+    const Index NoN{ CSRGraph<N, E>::NoN };
+    const std::size_t alpha{ 15 }, beta{ 18 };
+    const std::size_t n{ graph.size() };
+    assert(transposed.size() == n && source < n);
+
+    depths.assign(n, NoN);
+    parents.assign(n, NoN);
+    AtomicBitmap visited(n), front(n), next(n);
+    visited.claim(source);
+    depths[source] = 0;
+
+    std::vector<Index> frontier{ source };
+    std::vector<std::vector<Index>> locals(threadCount());
+    std::vector<std::size_t> edges(threadCount()), found(threadCount());
+    std::size_t frontEdges{ graph.degree(source) };
+    std::size_t openEdges{ graph.edgeCount() - frontEdges };
+    std::size_t frontSize{ 1 }, reached{ 1 };
+    bool bottomUp{ false };
+
+    for (std::size_t depth{1}; frontSize > 0; depth++)
+    {
+        if (!bottomUp && frontEdges * alpha > openEdges)
+        {
+            // list -> bitmap
+            bottomUp = true;
+            front.clear();
+            for (const Index v : frontier) front.set(v);
+        }
+        else if (bottomUp && frontSize * beta < n)
+        {
+            // bitmap -> list
+            bottomUp = false;
+            frontier.clear();
+            for (std::size_t w{0}; w < front.size(); w++)
+                if (const std::uint64_t bits{ front.word(w) })
+                    for (std::size_t b{0}; b < 64; b++)
+                        if ((bits >> b) & 1u) frontier.push_back(64 * w + b);
+        }
+
+        if (!bottomUp)
+        {
+            parallelFor(frontier.size(), grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+            {
+                std::vector<Index>& local{ locals[c] };
+                local.clear();
+                std::size_t sum{ 0 };
+                for (std::size_t i{begin}; i < end; i++)
+                    for (const Index child : graph.children(frontier[i]))
+                        if (visited.claim(child))
+                        {
+                            depths[child] = depth;
+                            parents[child] = frontier[i];
+                            local.push_back(child);
+                            sum += graph.degree(child);
+                        }
+                edges[c] = sum;
+            });
+            const std::size_t chunks{ chunkCount(frontier.size(), grain) };
+            frontier.clear();
+            frontEdges = 0;
+            for (std::size_t c{0}; c < chunks; c++)
+            {
+                frontier.insert(frontier.end(), locals[c].begin(), locals[c].end());
+                frontEdges += edges[c];
+            }
+            frontSize = frontier.size();
+        }
+        else
+        {
+            next.clear();
+            const std::size_t words{ visited.size() };
+            parallelFor(words, std::max<std::size_t>(grain / 64, 1), [&](std::size_t c, std::size_t begin, std::size_t end)
+            {
+                std::size_t sum{ 0 }, count{ 0 };
+                for (Index v{ 64 * begin }; v < std::min(64 * end, n); v++)
+                {
+                    if (visited.test(v)) continue;
+                    for (const Index parent : transposed.children(v))
+                        if (front.test(parent))
+                        {
+                            visited.set(v);
+                            next.set(v);
+                            depths[v] = depth;
+                            parents[v] = parent;
+                            sum += graph.degree(v);
+                            count++;
+                            break;
+                        }
+                }
+                edges[c] = sum;
+                found[c] = count;
+            });
+            const std::size_t chunks{ chunkCount(words, std::max<std::size_t>(grain / 64, 1)) };
+            frontEdges = 0;
+            frontSize = 0;
+            for (std::size_t c{0}; c < chunks; c++)
+            {
+                frontEdges += edges[c];
+                frontSize += found[c];
+            }
+            std::swap(front, next);
+        }
+        reached += frontSize;
+        openEdges -= std::min(openEdges, frontEdges);
+    }
+    return reached;
+}
+
+// ----------------------------------------------
+// Shortest Paths
+
+/**
+ * @brief Parallel Delta-Stepping.
+ *
+ * Single source shortest paths with the non-negative edge weights `weight(data)` (Meyer and Sanders).
+ * Tentative distances are sorted into buckets of width `delta`. The nodes of the smallest non-empty bucket are processed together:
+ * the threads split them and relax their light edges (weight up to `delta`) with an atomic minimum on the distances,
+ * which can refill the same bucket, until it stays empty. Then the heavy edges of all its nodes are relaxed once.
+ * Buckets are kept in a ring that covers the largest edge weight, but at most about twice the number of nodes; entries beyond its window wait in an overflow list.
+ * Once the ring runs empty the search jumps straight to the smallest waiting bucket, so memory does not grow with the ratio of the largest weight to `delta`, and neither does the time spent on empty buckets beyond the ring.
+ * Outdated bucket entries are skipped. All weights have to be finite.
+ *
+ * A small `delta` approaches Dijkstra's algorithm (little wasted work, little parallelism), a large one Bellman-Ford.
+ * The average edge weight times a small factor is a good start.
+ *
+ * @param graph the graph, a [Graph](@ref Graph) has to be [frozen](@ref Graph::freeze) first
+ * @param source start node
+ * @param delta bucket width, larger than 0
+ * @param weight callable `W(const E&)`, the weight of an edge
+ * @param [out] distances distance from the source, infinity (or the maximum of `W`) for unreached nodes
+ * @param grain minimal number of nodes per thread and phase
+ */
+template<class N, class E, class W, class Weight>
+void deltaStepping(const CSRGraph<N, E>& graph, std::size_t source, W delta, const Weight& weight,
+                   std::vector<W>& distances, std::size_t grain = 1 << 10)
+{
+    typedef std::size_t Index;
+    const std::size_t n{ graph.size() };
+    const W inf{ std::numeric_limits<W>::has_infinity ? std::numeric_limits<W>::infinity() : std::numeric_limits<W>::max() };
+    assert(delta > W(0) && source < n);
+
+    // ring of buckets, pending distances never exceed the current bucket by more than the largest weight;
+    // the ring is capped by the number of nodes, entries beyond its window wait in an overflow list
+    W heaviest{ 0 };
+    for (const E& data : graph.edgeData())
+    {
+        const W w{ weight(data) };
+        assert(w >= W(0) && w < inf);
+        heaviest = std::max(heaviest, w);
+    }
+    const std::size_t cap{ 2 * n + 2 };
+    const W span{ heaviest / delta };
+    const std::size_t ring{ (static_cast<double>(span) + 2. < static_cast<double>(cap)) ? static_cast<std::size_t>(span) + 2 : cap };
+    std::vector<std::vector<Index>> buckets(ring);
+    // entries beyond the window of the ring and their smallest bucket
+    std::vector<Index> overflow;
+    const std::size_t none{ std::numeric_limits<std::size_t>::max() };
+    std::size_t inRing{ 0 }, current{ 0 }, reserve{ none };
+
+    std::unique_ptr<std::atomic<W>[]> dist{ new std::atomic<W>[n] };
+    for (Index i{0}; i < n; i++) dist[i].store(inf, std::memory_order_relaxed);
+    dist[source].store(W(0), std::memory_order_relaxed);
+
+    // bucket of a node, saturated so that `current + ring` can not overflow
+    const std::size_t last{ std::numeric_limits<std::size_t>::max() / 2 };
+    const auto bucketOf{ [&](Index v)
+    {
+        const W q{ dist[v].load(std::memory_order_relaxed) / delta };
+        return (static_cast<double>(q) < static_cast<double>(last)) ? static_cast<std::size_t>(q) : last;
+    } };
+    // sorts a node into the ring if its bucket lies inside the window, else into the overflow list
+    const auto push{ [&](Index v)
+    {
+        const std::size_t b{ bucketOf(v) };
+        if (b < current + ring)
+        {
+            buckets[b % ring].push_back(v);
+            inRing++;
+        }
+        else
+        {
+            overflow.push_back(v);
+            reserve = std::min(reserve, b);
+        }
+    } };
+    push(source);
+
+    std::vector<std::vector<Index>> locals(threadCount());
+    std::vector<std::uint32_t> round(n, 0);
+    std::uint32_t phase{ 0 };
+    std::vector<Index> frontier, settled, waiting;
+
+    // relaxes the light or heavy edges of the frontier in parallel and sorts the improved nodes into their buckets
+    const auto relax{ [&](const std::vector<Index>& nodes, bool light)
+    {
+        parallelFor(nodes.size(), grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+        {
+            std::vector<Index>& local{ locals[c] };
+            local.clear();
+            for (std::size_t i{begin}; i < end; i++)
+            {
+                const Index u{ nodes[i] };
+                const W du{ dist[u].load(std::memory_order_relaxed) };
+                graph.forEachChild(u, [&](Index v, const E& data)
+                {
+                    const W w{ weight(data) };
+                    if ((w <= delta) != light) return;
+                    const W d{ du + w };
+                    W old{ dist[v].load(std::memory_order_relaxed) };
+                    while (d < old)
+                        if (dist[v].compare_exchange_weak(old, d, std::memory_order_relaxed))
+                        {
+                            local.push_back(v);
+                            break;
+                        }
+                });
+            }
+        });
+        for (std::size_t c{0}, chunks{ chunkCount(nodes.size(), grain) }; c < chunks; c++)
+            for (const Index v : locals[c]) push(v);
+    } };
+
+    while (inRing + overflow.size() > 0)
+    {
+        // jump to the smallest pending bucket: the next non-empty one of the ring, unless the overflow list holds a smaller one
+        while (inRing > 0 && current < reserve && buckets[current % ring].empty()) current++;
+        if (inRing == 0 || current >= reserve)
+        {
+            // move the window and take the overflow entries inside of it into the ring, entries of nodes that improved since are outdated
+            current = reserve;
+            reserve = none;
+            waiting.swap(overflow);
+            overflow.clear();
+            for (const Index v : waiting)
+                if (bucketOf(v) >= current) push(v);
+        }
+
+        std::vector<Index>& bucket{ buckets[current % ring] };
+        settled.clear();
+        while (!bucket.empty())
+        {
+            // take the bucket, skip nodes that moved to a smaller bucket and duplicates
+            phase++;
+            frontier.clear();
+            inRing -= bucket.size();
+            for (const Index v : bucket)
+            {
+                if (bucketOf(v) != current || round[v] == phase) continue;
+                round[v] = phase;
+                frontier.push_back(v);
+            }
+            bucket.clear();
+            settled.insert(settled.end(), frontier.begin(), frontier.end());
+            relax(frontier, true);
+        }
+        relax(settled, false);
+    }
+
+    distances.resize(n);
+    for (Index i{0}; i < n; i++) distances[i] = dist[i].load(std::memory_order_relaxed);
+}
+
+} /* vml */
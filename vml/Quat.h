@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec3.h"
+#include "Vec4.h"
+#include "Mat4.h"
+
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Quaternion.
+ *
+ * Quat is the vml:: implementation of a rotation quaternion `q = w + xi + yj + zk`. The layout is the same as Vec4: `(x, y, z, w)`, with the scalar part stored last like in GLSL.
+ * Unit quaternions describe pure rotations in 3D and are cheaper to compose, interpolate and apply than a full Mat4.
+ * Use `mat4()` and `quat(const Mat4&)` to convert at the boundary to matrix based APIs.
+ */
+struct Quat
+{
+    /// number of components
+    static const int size{ 4 };
+
+    // Attributes
+    /**
+     * @brief The Components.
+     *
+     * `x`, `y` and `z` are the vector (imaginary) part, `w` is the scalar (real) part.
+     */
+    Float x, y, z, w;
+
+    // Constructors
+    Quat(Float, Float, Float, Float);
+    Quat(const Vec3&, Float);
+    Quat(const Vec4&);
+    Quat();
+
+    // Methods
+    Float norm() const;
+    Quat normalized() const;
+    Quat conjugated() const;
+    Quat inverse() const;
+    Float angle() const;
+    Vec3 axis() const;
+    Vec3 rotate(const Vec3&) const;
+    Vec4 vec4() const;
+    Mat4 mat4() const;
+
+    // Operators
+    Quat operator -() const;
+    void operator += (const Quat&);
+    void operator -= (const Quat&);
+    void operator *= (const Quat&);
+    void operator *= (Float);
+
+    // Debugging
+    friend std::ostream& operator << (std::ostream&, const Quat&);
+};
+
+// ----------------------------------------------
+// Namespace Methods
+
+Quat operator + (const Quat& p, const Quat& q);
+Quat operator - (const Quat& p, const Quat& q);
+Quat operator * (const Quat& p, const Quat& q);
+Quat operator * (Float factor, const Quat& q);
+Quat operator * (const Quat& q, Float factor);
+
+Float dot(const Quat& p, const Quat& q);
+Quat quat(const Mat4&);
+Quat nlerp(const Quat& p, const Quat& q, Float t);
+Quat slerp(const Quat& p, const Quat& q, Float t);
+
+// Batch interpolation
+void rotate(const Quat&, const std::vector<Vec3>& input, std::vector<Vec3>& output);
+void slerp(const std::vector<Quat>& from, const std::vector<Quat>& to, Float t, std::vector<Quat>& output);
+void slerp(const std::vector<Quat>& from, const std::vector<Quat>& to, const std::vector<Float>& t, std::vector<Quat>& output);
+
+/**
+ * @brief Dual Quaternion.
+ *
+ * A dual quaternion `real + eps * dual` describes a rigid transformation (rotation followed by a translation) in eight numbers.
+ * Compared to Mat4 it can be blended linearly without introducing shear, which makes it the usual choice for skinning.
+ */
+struct DualQuat
+{
+    /// rotation part
+    Quat real;
+    /// translation part, `0.5 * t * real`
+    Quat dual;
+
+    // Constructors
+    DualQuat(const Quat&, const Quat&);
+    DualQuat(const Quat&, const Vec3&);
+    DualQuat();
+
+    // Methods
+    DualQuat normalized() const;
+    DualQuat conjugated() const;
+    Vec3 translation() const;
+    Vec3 transform(const Vec3&) const;
+    Mat4 mat4() const;
+
+    // Debugging
+    friend std::ostream& operator << (std::ostream&, const DualQuat&);
+};
+
+DualQuat operator * (const DualQuat& p, const DualQuat& q);
+DualQuat nlerp(const DualQuat& p, const DualQuat& q, Float t);
+
+} /* vml */
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Transform.h"
+#include "Arc.h"
+#include "ArcShape.h"
+
+namespace vml {
+
+/**
+ * @brief Linear Motion of a Shape.
+ *
+ * Interpolates the parameters of [ArcShape::transform](@ref ArcShape::transform) between a start and an end pose:
+ * at time `t` in [0, 1] the shape is rotated by `lerp(rot0, rot1)` about the origin and then moved by `lerp(off0, off1)`.
+ */
+struct Motion
+{
+    /// rotation at t = 0
+    Float rot0;
+    /// offset at t = 0
+    Vec2 off0;
+    /// rotation at t = 1
+    Float rot1;
+    /// offset at t = 1
+    Vec2 off1;
+
+    // Constructors
+    Motion(Float rot0, const Vec2& off0, Float rot1, const Vec2& off1);
+    Motion(Float rot, const Vec2& off);
+    Motion();
+
+    // Methods
+    Transform2 at(Float t) const;
+    Float speed(Float radius) const;
+};
+
+// ----------------------------------------------
+// Distances
+
+Float distance(const Arc&, const Arc&);
+Float distance(const ArcShape&, const ArcShape&);
+
+// ----------------------------------------------
+// Continuous Collision Detection
+
+bool timeOfContact(const ArcShape& a, const Motion& ma, const ArcShape& b, const Motion& mb, Float& toc, Float tolerance = 1e-4f);
+
+} /* vml */
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "Vec3.h"
+#include "Mat4.h"
+#include "Quat.h"
+
+namespace vml {
+
+/**
+ * @brief Affine 3D Transformation (3x4 Matrix).
+ *
+ * Affine3 stores only the upper three rows of an affine Mat4, because the last row is always `(0, 0, 0, 1)`.
+ * That saves a quarter of the memory and composing two transformations needs 36 instead of 64 multiplications.
+ * The left 3x3 block is the linear part (rotation, scaling, shear), the last column is the translation.
+ * Use `mat4()` to convert at the boundary to matrix based APIs, e.g. OpenGL.
+ */
+struct Affine3
+{
+    /// number of rows
+    static const int rows{ 3 };
+    /// number of columns
+    static const int cols{ 4 };
+    /// number of Float entries = 3*4
+    static const int fSize{ 12 };
+
+    // Constructors
+    Affine3(const Vec4&, const Vec4&, const Vec4&);
+    Affine3(const Quat&, const Vec3& = Vec3(0.f));
+    Affine3(const Mat4&);
+    Affine3();
+
+    // Access to entries
+    Float* data();
+    Float& operator[] (int i);
+    const Float& operator[] (int i) const;
+    Float& at(int, int);
+    Float at(int, int) const;
+    Vec3 translation() const;
+
+    // Methods
+    Vec3 point(const Vec3&) const;
+    Vec3 direction(const Vec3&) const;
+    Affine3 inverse() const;
+    Mat4 mat4() const;
+
+private:
+    /// internal storage, row-major
+    Float M[fSize];
+};
+
+Affine3 operator * (const Affine3&, const Affine3&);
+std::ostream& operator << (std::ostream&, const Affine3&);
+
+/**
+ * @brief Rigid 2D Transformation (Rotation and Offset).
+ *
+ * Transform2 describes the same transformation as [Arc::transform](@ref Arc::transform): first a rotation by an angle around the origin, then a translation by an offset.
+ * The cosine and sine of the angle are computed once on construction, so applying the transformation to many points or arcs needs no further trigonometric calls.
+ * The angle itself is kept as well, because arcs store their start direction as an angle.
+ */
+class Transform2
+{
+public:
+    // Constructors
+    Transform2(Float, const Vec2& = Vec2(0.f));
+    Transform2();
+
+    // Access
+    Float angle() const;
+    const Vec2& rotation() const;
+    const Vec2& offset() const;
+
+    // Methods
+    Vec2 point(const Vec2&) const;
+    Vec2 direction(const Vec2&) const;
+    Transform2 inverse() const;
+    Mat4 mat4() const;
+
+    friend Transform2 operator * (const Transform2&, const Transform2&);
+
+private:
+    Transform2(Float, const Vec2&, const Vec2&);
+
+    /// rotation angle in radians
+    Float rot;
+    /// unit vector `(cos(rot), sin(rot))`
+    Vec2 cs;
+    /// offset, applied after the rotation
+    Vec2 off;
+};
+
+std::ostream& operator << (std::ostream&, const Transform2&);
+
+} /* vml */
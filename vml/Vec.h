@@ -0,0 +1,463 @@
+#pragma once
+
+#include "Basics.h"
+#include "parse.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Vector Expression (CRTP Base).
+ *
+ * Every vector and every arithmetic expression of vectors derives from VecExpr.
+ * Expressions like `a*s + b - c` are not evaluated when they are written, but build a small tree of expression objects.
+ * Only the assignment to a [Vec](@ref Vec) evaluates the tree, element by element in a single loop without temporary vectors.
+ * Every expression provides `value_type`, `size` and a const `operator[]`.
+ */
+template<typename E>
+struct VecExpr
+{
+    /// the derived expression
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+/**
+ * @brief Storage of a Vec.
+ *
+ * The entries are stored sequentially, so they can be passed to C-APIs or accessed via `operator[]` without flow control.
+ * Two, three and four dimensional vectors name their entries like GLSL, `x, y, z, w`, all others store them in the array `data`.
+ */
+template<typename T, int N>
+struct VecStorage
+{
+    /// the entries
+    T data[N];
+    T* entries() { return data; }
+    const T* entries() const { return data; }
+};
+template<typename T>
+struct VecStorage<T, 2>
+{
+    /// the coordinates
+    T x, y;
+    T* entries() { return &x; }
+    const T* entries() const { return &x; }
+};
+template<typename T>
+struct VecStorage<T, 3>
+{
+    /// the coordinates
+    T x, y, z;
+    T* entries() { return &x; }
+    const T* entries() const { return &x; }
+};
+template<typename T>
+struct VecStorage<T, 4>
+{
+    /// the coordinates
+    T x, y, z, w;
+    T* entries() { return &x; }
+    const T* entries() const { return &x; }
+};
+
+/**
+ * @brief Generic Fixed Size Vector.
+ *
+ * `Vec<T, N>` is a vector of `N` entries of type `T`, e.g. `Vec<float, 3>`, `Vec<double, 2>` or `Vec<int, 4>`.
+ * All dimensions and types share the same implementation, and therefore the same performance characteristics.
+ * The entries are stored sequentially (see [VecStorage](@ref VecStorage)), vectors up to four dimensions have the named members `x, y, z, w`.
+ * Vec2, Vec3 and Vec4 are thin wrappers of `Vec<Float, N>`, which add the GLSL style API and evaluate their own operators directly.
+ *
+ * @tparam T entry type
+ * @tparam N dimension
+ */
+template<typename T, int N>
+struct Vec : VecExpr<Vec<T, N>>, VecStorage<T, N>
+{
+    static_assert(N > 0, "Vec needs at least one entry.");
+    static_assert(sizeof(VecStorage<T, N>) == N * sizeof(T), "The entries have to be stored without padding.");
+
+    /// entry type
+    using value_type = T;
+    /// vector dimensions
+    static constexpr int size{ N };
+
+    // Constructors
+
+    /// Zero Element (Default Constructor).
+    Vec() : VecStorage<T, N>{}
+    {}
+
+    /// Single Number Constructor: all entries are set to the same value.
+    explicit Vec(T all)
+    {
+        for (int i{0}; i < N; i++) (*this)[i] = all;
+    }
+
+    /// Standard Constructor: one parameter per entry, e.g. `Vec<float, 3>(x, y, z)`.
+    template<typename... Ts, typename = std::enable_if_t<(N > 1) && (sizeof...(Ts) == N)>>
+    Vec(Ts... entries) : VecStorage<T, N>{ static_cast<T>(entries)... }
+    {}
+
+    /// Expression Constructor: evaluates a vector expression in one loop.
+    template<typename E>
+    Vec(const VecExpr<E>& expr)
+    {
+        static_assert(E::size == N, "Vector dimensions do not match.");
+        const E& e{ expr.self() };
+        for (int i{0}; i < N; i++) (*this)[i] = static_cast<T>(e[i]);
+    }
+
+    // Subscription
+    T& operator[] (int i) { return this->entries()[i]; }
+    const T& operator[] (int i) const { return this->entries()[i]; }
+    T* begin() { return this->entries(); }
+    T* end() { return this->entries() + N; }
+    const T* begin() const { return this->entries(); }
+    const T* end() const { return this->entries() + N; }
+
+    // Operators
+
+    /// Expression Assignment: evaluates the expression directly into this vector.
+    template<typename E>
+    Vec& operator = (const VecExpr<E>& expr)
+    {
+        static_assert(E::size == N, "Vector dimensions do not match.");
+        const E& e{ expr.self() };
+        for (int i{0}; i < N; i++) (*this)[i] = static_cast<T>(e[i]);
+        return *this;
+    }
+    template<typename E>
+    void operator += (const VecExpr<E>& expr)
+    {
+        const E& e{ expr.self() };
+        for (int i{0}; i < N; i++) (*this)[i] += e[i];
+    }
+    template<typename E>
+    void operator -= (const VecExpr<E>& expr)
+    {
+        const E& e{ expr.self() };
+        for (int i{0}; i < N; i++) (*this)[i] -= e[i];
+    }
+    void operator *= (T factor)
+    {
+        for (int i{0}; i < N; i++) (*this)[i] *= factor;
+    }
+    void operator /= (T dividend)
+    {
+        for (int i{0}; i < N; i++) (*this)[i] /= dividend;
+    }
+
+    // Methods
+    T norm() const;
+    Vec normalized() const;
+};
+
+// ----------------------------------------------
+// Expression Nodes
+
+/// True for Vec<T, N>: vectors are stored by reference inside expressions, all other nodes by value.
+template<typename E> struct _isVec : std::false_type {};
+template<typename T, int N> struct _isVec<Vec<T, N>> : std::true_type {};
+
+/// Storage of an operand inside an expression node.
+template<typename E>
+using _Operand = std::conditional_t<_isVec<E>::value, const E&, const E>;
+
+///@{
+/// Element operations of the expression nodes.
+struct _Add { template<typename T> static T apply(T a, T b) { return a + b; } };
+struct _Sub { template<typename T> static T apply(T a, T b) { return a - b; } };
+struct _Mul { template<typename T> static T apply(T a, T b) { return a * b; } };
+struct _Div { template<typename T> static T apply(T a, T b) { return a / b; } };
+///@}
+
+/**
+ * @brief Element wise Vector Expression.
+ *
+ * Combines the entries of two expressions of same dimension with the operation `Op`.
+ */
+template<typename L, typename R, typename Op>
+struct VecBinary : VecExpr<VecBinary<L, R, Op>>
+{
+    static_assert(L::size == R::size, "Vector dimensions do not match.");
+    using value_type = typename L::value_type;
+    static constexpr int size{ L::size };
+
+    _Operand<L> l;
+    _Operand<R> r;
+
+    VecBinary(const L& _l, const R& _r) : l(_l), r(_r) {}
+    value_type operator[] (int i) const { return Op::template apply<value_type>(l[i], r[i]); }
+};
+
+/**
+ * @brief Vector-Scalar Expression.
+ *
+ * Combines every entry of an expression with the same scalar using the operation `Op`.
+ */
+template<typename L, typename Op>
+struct VecScalar : VecExpr<VecScalar<L, Op>>
+{
+    using value_type = typename L::value_type;
+    static constexpr int size{ L::size };
+
+    _Operand<L> l;
+    const value_type s;
+
+    VecScalar(const L& _l, value_type _s) : l(_l), s(_s) {}
+    value_type operator[] (int i) const { return Op::template apply<value_type>(l[i], s); }
+};
+
+/**
+ * @brief Negated Vector Expression.
+ */
+template<typename L>
+struct VecNegate : VecExpr<VecNegate<L>>
+{
+    using value_type = typename L::value_type;
+    static constexpr int size{ L::size };
+
+    _Operand<L> l;
+
+    VecNegate(const L& _l) : l(_l) {}
+    value_type operator[] (int i) const { return -l[i]; }
+};
+
+// ----------------------------------------------
+// Namespace Methods
+
+/**
+ * @brief Vector Operators.
+ *
+ * The binary operators (`+`,`-`,`*`,`/`) and the inversion return lightweight expression objects instead of vectors.
+ * The arithmetic is done once the expression is assigned to a Vec.
+ */
+///@{
+template<typename L, typename R>
+VecBinary<L, R, _Add> operator + (const VecExpr<L>& l, const VecExpr<R>& r)
+{
+    return VecBinary<L, R, _Add>(l.self(), r.self());
+}
+template<typename L, typename R>
+VecBinary<L, R, _Sub> operator - (const VecExpr<L>& l, const VecExpr<R>& r)
+{
+    return VecBinary<L, R, _Sub>(l.self(), r.self());
+}
+template<typename L>
+VecScalar<L, _Mul> operator * (const VecExpr<L>& l, typename L::value_type factor)
+{
+    return VecScalar<L, _Mul>(l.self(), factor);
+}
+template<typename L>
+VecScalar<L, _Mul> operator * (typename L::value_type factor, const VecExpr<L>& l)
+{
+    return VecScalar<L, _Mul>(l.self(), factor);
+}
+template<typename L>
+VecScalar<L, _Div> operator / (const VecExpr<L>& l, typename L::value_type dividend)
+{
+    return VecScalar<L, _Div>(l.self(), dividend);
+}
+template<typename L>
+VecNegate<L> operator - (const VecExpr<L>& l)
+{
+    return VecNegate<L>(l.self());
+}
+///@}
+
+/**
+ * @brief Element wise Product (Hadamard Product).
+ */
+template<typename L, typename R>
+VecBinary<L, R, _Mul> hadamard(const VecExpr<L>& l, const VecExpr<R>& r)
+{
+    return VecBinary<L, R, _Mul>(l.self(), r.self());
+}
+
+/**
+ * @brief Dot Product.
+ *
+ * Sum of the element wise products. Works on vectors and expressions, e.g. `dot(a - b, c)`.
+ */
+template<typename L, typename R>
+typename L::value_type dot(const VecExpr<L>& l, const VecExpr<R>& r)
+{
+    static_assert(L::size == R::size, "Vector dimensions do not match.");
+    const L& a{ l.self() };
+    const R& b{ r.self() };
+    typename L::value_type sum{ 0 };
+    for (int i{0}; i < L::size; i++) sum += a[i] * b[i];
+    return sum;
+}
+
+/**
+ * @brief Vector Length.
+ *
+ * The Euclidian norm of a vector or an expression.
+ */
+template<typename E>
+typename E::value_type norm(const VecExpr<E>& e)
+{
+    using T = typename E::value_type;
+    return static_cast<T>(std::sqrt(dot(e, e)));
+}
+
+/**
+ * @brief Vector Distance.
+ *
+ * The length of the difference of `u` and `v`, evaluated without a temporary vector.
+ */
+template<typename L, typename R>
+typename L::value_type distance(const VecExpr<L>& u, const VecExpr<R>& v)
+{
+    return norm(u - v);
+}
+
+/**
+ * @brief Cross Product.
+ *
+ * Only defined for three dimensional vectors and expressions, e.g. `cross(a + b, b)`. Each operand is evaluated once.
+ */
+template<typename L, typename R>
+Vec<typename L::value_type, 3> cross(const VecExpr<L>& l, const VecExpr<R>& r)
+{
+    static_assert(L::size == 3 && R::size == 3, "The cross product is only defined for three dimensions.");
+    using T = typename L::value_type;
+    const Vec<T, 3> u{ l.self() };
+    const Vec<T, 3> v{ r.self() };
+    return Vec<T, 3>(u[1] * v[2] - u[2] * v[1],
+                     u[2] * v[0] - u[0] * v[2],
+                     u[0] * v[1] - u[1] * v[0]);
+}
+
+/// Vector Length: see [norm](@ref norm).
+template<typename T, int N>
+T Vec<T, N>::norm() const
+{
+    return vml::norm(*this);
+}
+
+/// Unit Vector: the vector divided by its length.
+template<typename T, int N>
+Vec<T, N> Vec<T, N>::normalized() const
+{
+    return (*this) / norm();
+}
+
+/**
+ * @brief Print Overload.
+ *
+ * Uses the same tuple format `(a,b,...)` as the hand written vectors.
+ */
+template<typename T, int N>
+std::ostream& operator << (std::ostream& os, const Vec<T, N>& v)
+{
+    os << '(';
+    for (int i{0}; i < N; i++) os << v[i] << ((i < N-1) ? "," : "");
+    os << ')';
+    return os;
+}
+
+// ----------------------------------------------
+// Aliases
+
+using Vec2f = Vec<float, 2>;
+using Vec3f = Vec<float, 3>;
+using Vec4f = Vec<float, 4>;
+using Vec2d = Vec<double, 2>;
+using Vec3d = Vec<double, 3>;
+using Vec4d = Vec<double, 4>;
+using Vec2i = Vec<int, 2>;
+using Vec3i = Vec<int, 3>;
+using Vec4i = Vec<int, 4>;
+
+// ----------------------------------------------
+// Parsing
+namespace parse
+{
+
+/**
+ * @brief String zu Zahl.
+ *
+ * Ganzzahlige Typen werden mit `std::stoll`, alle anderen mit `std::stod` gelesen und anschließend gecastet.
+ */
+template<typename T>
+bool _ston(T& t, const String& s)
+{
+    try
+    {
+        if constexpr (std::is_integral<T>::value) t = static_cast<T>(std::stoll(s));
+        else t = static_cast<T>(std::stod(s));
+    } catch(...) { return false; }
+    return true;
+}
+
+/**
+ * @brief String zu Vec.
+ *
+ * Liest einen Vektor im Tupelformat "(a,b,...)". Der String muss genau `N` durch Kommas getrennte Einträge enthalten.
+ * Bei einem erfolgreichen Parsing wird true zurückgegeben.
+ */
+template<typename T, int N>
+bool stoVec(Vec<T, N>& v, const String& s)
+{
+    const auto bl{ s.find_first_of("(") };
+    const auto br{ s.find_first_of(")", bl) };
+    if (bl==String::npos || br==String::npos) return false;
+    auto start{ bl };
+    for (int i{0}; i < N; i++)
+    {
+        // the last entry ends at the bracket, all others at the next comma
+        const auto stop{ (i < N-1) ? s.find_first_of(",", start+1) : br };
+        if (stop==String::npos || stop > br) return false;
+        if (!_ston(v[i], s.substr(start+1, stop-start-1))) return false;
+        start = stop;
+    }
+    return true;
+}
+
+/**
+ * @brief String zu Vec-Vector.
+ *
+ * Liest eine Liste von Vektoren im Format "[ (a1,b1), (a2,b2), ..., (an,bn) ]".
+ * Jedes Klammerpaar wird mit [stoVec](@ref stoVec) gelesen, die Kommas zwischen den Tupeln werden übersprungen.
+ */
+template<typename T, int N>
+bool stoVecVector(std::vector<Vec<T, N>>& vv, const String& s)
+{
+    vv.clear();
+    const auto open{ s.find_first_of("[") };
+    const auto close{ s.find_last_of("]") };
+    if (open==String::npos || close==String::npos) return false;
+    auto bl{ s.find_first_of("(", open) };
+    while (bl!=String::npos && bl < close)
+    {
+        const auto br{ s.find_first_of(")", bl) };
+        if (br==String::npos || br > close) return false;
+        Vec<T, N> v;
+        if (!stoVec(v, s.substr(bl, br-bl+1))) return false;
+        vv.push_back(v);
+        bl = s.find_first_of("(", br);
+    }
+    return true;
+}
+
+/**
+ * @brief Vec als String.
+ *
+ * Verwendet das Klammerformat "(a,b,...)", wie die handgeschriebenen Vektoren.
+ */
+template<typename T, int N>
+String toString(const Vec<T, N>& v)
+{
+    std::stringstream ss;
+    ss << v;
+    return ss.str();
+}
+
+} /* namespace parse */
+
+} /* namespace vml */
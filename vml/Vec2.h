@@ -2,6 +2,7 @@
 
 #include "Basics.h"
 #include "parse.h"
+#include "Vec.h"
 
 #include <string> // for parsing
 
@@ -13,41 +14,29 @@ namespace vml
  *
  * Vec2 is the vml:: implementation of a two dimensional vector object. The API is designed to be similar to GLSL: `Vec2 = (x,y)`.
  * @seealso https://www.khronos.org/opengl/wiki/Data_Type_(GLSL)
+ *
+ * Vec2 is a thin wrapper of [Vec<Float, 2>](@ref Vec): the coordinates `x, y`, the subscription, the norm and the assignment operators come from the generic vector.
+ * The binary operators of two Vec2 return a Vec2 directly, mixed with [expressions](@ref VecExpr) they are evaluated lazily.
  */
-struct Vec2
+struct Vec2 : Vec<Float, 2>
 {
-    /// vector dimensions
-    static const int size{ 2 };
-
-    
-    // Attributes
-    /**
-     * @brief The Coordinates.
-     *
-     * The coordinates are stored as named members of the Vec2-struct to allow for convenient member call via the `.`-operator.
-     */
-    Float x, y;
-
     // Constructors
     Vec2(Float, Float);
     Vec2(Float);
     Vec2();
 
+    /// Expression Constructor: evaluates a vector expression, e.g. `Vec2(a*s + b - c)`.
+    template<typename E>
+    Vec2(const VecExpr<E>& expr) : Vec<Float, 2>(expr)
+    {}
+
     // Methods
-    Float norm() const;
     Vec2 normalized() const;
     Vec2 rotated(Float) const;
     std::string TikZ(const char*) const;
-    
-    // Subscription
-    /// @Todo: subscription, to allow for array style member access, member should be stored sequentially, so no flow control is needed.
 
     // Operators
     Vec2 operator -() const;
-    void operator += (const Vec2&);
-    void operator -= (const Vec2&);
-    void operator *= (Float);
-    void operator /= (Float);
 };
 
 // ----------------------------------------------
@@ -2,6 +2,7 @@
 
 #include "Basics.h"
 #include "parse.h"
+#include "Vec.h"
 
 namespace vml {
 
@@ -14,35 +15,29 @@ namespace vml {
  *  - x-Achse: Links nach Rechts
  *  - y-Achse: Unten nach Oben
  *  - z-Achse: Vorne nach Hinten
+ *
+ * Vec3 ist eine dünne Hülle um [Vec<Float, 3>](@ref Vec): Die Koordinaten `x, y, z`, die Indizierung, die Norm und die mutierenden Operatoren stammen vom generischen Vektor.
+ * Die binären Operatoren zweier Vec3 geben direkt einen Vec3 zurück, gemischt mit [Ausdrücken](@ref VecExpr) werden sie erst bei der Zuweisung ausgewertet.
  */
-struct Vec3
+struct Vec3 : Vec<Float, 3>
 {
-    /// Dimension des Vektor
-    static const int size{ 3 };
-    
-    /// Die x-Koordinate
-    Float x;
-    /// Die y-Koordinate
-    Float y;
-    /// Die z-Koordinate
-    Float z;
-    
     // Konstruktoren
     Vec3(Float, Float, Float);
     Vec3(Float);
     Vec3();
-    
+
+    /// Ausdruck Konstruktor: wertet einen Vektorausdruck aus, z.B. `Vec3(a*s + b - c)`.
+    template<typename E>
+    Vec3(const VecExpr<E>& expr) : Vec<Float, 3>(expr)
+    {}
+
     // Methoden
-    Float norm() const;
     Vec3 normalized() const;
-    
+    Vec3 rotated(Float, const Vec3&) const;
+
     // Operatoren
     Vec3 operator -() const;
-    void operator += (const Vec3& other);
-    void operator -= (const Vec3& other);
-    void operator *= (Float factor);
-    void operator /= (Float factor);
-    
+
     // Debugging
     friend std::ostream& operator << (std::ostream& os, const Vec3& v);
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Basics.h"
+#include "parse.h"
+#include "Vec.h"
 
 #include <array>
 
@@ -11,20 +13,12 @@ namespace vml {
  *
  * Vec4 is the vml:: implementation of a four dimensional vector object. The API is designed to be similar to GLSL: `Vec4 = (x, y, z, w)`.
  * @seealso https://www.khronos.org/opengl/wiki/Data_Type_(GLSL)
+ *
+ * Vec4 is a thin wrapper of [Vec<Float, 4>](@ref Vec): the coordinates `x, y, z, w`, the subscription, the norm and the assignment operators come from the generic vector.
+ * The binary operators of two Vec4 return a Vec4 directly, mixed with [expressions](@ref VecExpr) they are evaluated lazily.
  */
-struct Vec4
+struct Vec4 : Vec<Float, 4>
 {
-    /// vector dimensions
-    static const int size{ 4 };
-
-    // Attributes
-    /**
-     * @brief The Coordinates.
-     *
-     * The coordinates are stored as named members of the Vec4-struct to allow for convenient member call via the `.`-operator.
-     */
-    Float x, y, z, w;
-
     // Constructors
     Vec4(Float, Float, Float, Float);
     Vec4(Float);
@@ -34,6 +28,7 @@ struct Vec4
      * @brief Templated Array Constructor.
      *
      * Enables initialization of a Vec4 by passing an instance of a type that supports the sub^^scription operator, e.g., std::vector or std::array. This enables easy conversion from other C++libraries to vml-compatible data.
+     * Vector [expressions](@ref VecExpr) support the subscription as well, so `Vec4(a*s + b - c)` evaluates the expression.
      */
     template<typename ArrayType>
     Vec4(const ArrayType& data) :
@@ -41,19 +36,11 @@ struct Vec4
     {}
 
     // Methods
-    Float norm() const;
     Vec4 normalized() const;
     std::array<Float, size> array() const;
 
-    // Subscription
-    /// @Todo: subscription, to allow for array style member access, member should be stored sequentially, so no flow control is needed.
-
     // Operators
     Vec4 operator -() const;
-    void operator += (const Vec4&);
-    void operator -= (const Vec4&);
-    void operator *= (Float);
-    void operator /= (Float);
 
     // Debugging
     friend std::ostream& operator << (std::ostream&, const Vec4&);
@@ -71,6 +58,15 @@ Vec4 operator / (const Vec4& v, Float dividend);
 Float distance(const Vec4& u, const Vec4& v);
 Float dot(const Vec4& u, const Vec4& v);
 
-///@Todo: Parsing
+// ----------------------------------------------
+// Parsing
+namespace parse
+{
+
+bool stoV4(Vec4&, const String&);
+bool stoV4vec(std::vector<Vec4>&, const String&);
+String toString(const Vec4&);
+
+} /* namespace parse */
 
 } /* vml */
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Basics.h"
+#include "Vec2.h"
+#include "AABB.h"
+#include "Arc.h"
+#include "ArcShape.h"
+
+#include <ostream>
+#include <string>
+
+namespace vml {
+
+/**
+ * @brief Streaming Text Writer.
+ *
+ * Base of the export writers. Text is appended to a buffer that is reused for all elements, numbers are formatted with `std::to_chars` instead of a `std::stringstream`.
+ * A writer either collects everything in its buffer (see [str](@ref str)) or streams to a `std::ostream`:
+ * then the buffer is written to the stream whenever it grows beyond `chunk` bytes, at [flush](@ref flush) and in the destructor.
+ */
+class Writer
+{
+public:
+    // Constructors
+    Writer();
+    Writer(std::ostream&, std::size_t chunk = 1 << 16);
+    Writer(const Writer&) = delete;
+    Writer& operator = (const Writer&) = delete;
+    virtual ~Writer();
+
+    // Buffer
+    const std::string& str() const;
+    void clear();
+    void flush();
+
+    // Primitives
+    Writer& put(Float);
+    Writer& put(const Vec2&);
+    Writer& put(const char*);
+    Writer& put(char);
+
+protected:
+    void spill();
+
+    /// reused text buffer
+    std::string buffer;
+    /// optional target stream
+    std::ostream* os;
+    /// buffer size that triggers writing to the stream
+    std::size_t chunk;
+};
+
+/**
+ * @brief TikZ Writer.
+ *
+ * Writes points, arcs and shapes as TikZ commands (see [ArcShape::TikZ](@ref ArcShape::TikZ)), one `\draw` per point or shape.
+ */
+class TikZWriter : public Writer
+{
+public:
+    using Writer::Writer;
+
+    TikZWriter& write(const Vec2&, const char* optionals = "");
+    TikZWriter& write(const Arc&);
+    TikZWriter& write(const ArcShape&, const char* optionals = "");
+};
+
+/**
+ * @brief SVG Writer.
+ *
+ * Writes shapes as SVG `<path>` elements, the path data is generated directly from the arcs: straight arcs become `L`, curved arcs `A` commands.
+ * Coordinates are written unchanged, SVG's y-axis points down, so the image appears mirrored unless the document (or a `transform` attribute) flips it.
+ */
+class SVGWriter : public Writer
+{
+public:
+    using Writer::Writer;
+
+    SVGWriter& begin(const AABB2& viewBox);
+    SVGWriter& end();
+    SVGWriter& path(const ArcShape&, const char* attributes = "fill=\"none\" stroke=\"black\"");
+    SVGWriter& pathData(const ArcShape&);
+    SVGWriter& pathData(const Arc&);
+};
+
+} /* vml */
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace vml {
+
+/**
+ * @brief Number of Worker Threads.
+ *
+ * The number of hardware threads as reported by `std::thread::hardware_concurrency`. Falls back to 1 if the number is unknown.
+ */
+inline std::size_t threadCount()
+{
+    const unsigned n{ std::thread::hardware_concurrency() };
+    return (n == 0) ? 1 : n;
+}
+
+/**
+ * @brief Number of Chunks.
+ *
+ * Determines in how many chunks `n` work items are split, so that every chunk has at least `grain` items and there are not more chunks than threads.
+ *
+ * @param n number of work items
+ * @param grain minimal number of items per chunk, small inputs run on the calling thread only
+ */
+inline std::size_t chunkCount(std::size_t n, std::size_t grain)
+{
+    if (n == 0) return 0;
+    grain = std::max<std::size_t>(grain, 1);
+    return std::min((n + grain - 1) / grain, threadCount());
+}
+
+/**
+ * @brief Parallel For Loop.
+ *
+ * Splits the index range [0, n) into [chunkCount](@ref chunkCount) contiguous chunks and calls `f(chunk, begin, end)` once per chunk.
+ * The first chunk runs on the calling thread, the others on their own `std::thread`. The function returns after all chunks are done.
+ * Chunks are ordered, i.e. chunk `c` covers smaller indices than chunk `c+1`, so results can be merged in order.
+ *
+ * @param n number of work items
+ * @param grain minimal number of items per chunk
+ * @param f callable with the signature `void(std::size_t chunk, std::size_t begin, std::size_t end)`
+ */
+template<typename F>
+void parallelFor(std::size_t n, std::size_t grain, const F& f)
+{
+    const std::size_t chunks{ chunkCount(n, grain) };
+    if (chunks == 0) return;
+    if (chunks == 1)
+    {
+        f(std::size_t{0}, std::size_t{0}, n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks - 1);
+    for (std::size_t c{1}; c < chunks; c++)
+    {
+        const std::size_t begin{ n * c / chunks };
+        const std::size_t end{ n * (c + 1) / chunks };
+        threads.emplace_back([&f, c, begin, end] { f(c, begin, end); });
+    }
+    f(std::size_t{0}, std::size_t{0}, n / chunks);
+    for (std::thread& t : threads) t.join();
+}
+
+} /* vml */
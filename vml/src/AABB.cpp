@@ -0,0 +1,404 @@
+#include "vml/AABB.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::min, std::max
+#include <limits> // std::numeric_limits
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// infinity as Float
+const Float _inf{ std::numeric_limits<Float>::infinity() };
+
+/// minimal number of points per thread for the bulk bounds
+const std::size_t _grain{ 1 << 15 };
+
+/**
+ * @brief Slab Test.
+ *
+ * Clips the ray parameter interval [tnear, tfar] with the slab between `lo` and `hi` of one axis.
+ * A direction of 0 gives infinite parameters, so the interval is either kept (origin inside the slab) or emptied.
+ */
+inline void _slab(Float o, Float d, Float lo, Float hi, Float& tnear, Float& tfar)
+{
+    if (d == 0.f)
+    {
+        if (o < lo || hi < o) { tnear = _inf; tfar = -_inf; }
+        return;
+    }
+    const Float inv{ 1.f / d };
+    const Float t0{ (lo - o) * inv };
+    const Float t1{ (hi - o) * inv };
+    tnear = std::max(tnear, std::min(t0, t1));
+    tfar  = std::min(tfar,  std::max(t0, t1));
+}
+
+// ----------------------------------------------
+// AABB2: Constructors
+
+/**
+ * @brief Corner Constructor.
+ *
+ * Initializes the two corners explicitly. `lo` has to be smaller than `hi` in both coordinates, otherwise the box is empty.
+ */
+AABB2::AABB2(const Vec2& _lo, const Vec2& _hi) : lo(_lo), hi(_hi)
+{}
+
+/**
+ * @brief Point Constructor.
+ *
+ * A box of size 0 that contains only the point `p`.
+ */
+AABB2::AABB2(const Vec2& p) : AABB2(p, p)
+{}
+
+/**
+ * @brief Empty Box (Default Constructor).
+ *
+ * The corners are set to +inf and -inf, so that extending the box by a point results in a box containing only that point.
+ */
+AABB2::AABB2() : AABB2(Vec2(_inf), Vec2(-_inf))
+{}
+
+// ----------------------------------------------
+// AABB2: Properties
+
+/// True, if the box does not contain any point.
+bool AABB2::isEmpty() const
+{
+    return (hi.x < lo.x) || (hi.y < lo.y);
+}
+
+/// Width and height of the box.
+Vec2 AABB2::size() const
+{
+    return hi - lo;
+}
+
+/// Center of the box.
+Vec2 AABB2::center() const
+{
+    return .5f * (lo + hi);
+}
+
+// ----------------------------------------------
+// AABB2: Methods
+
+///@{
+/**
+ * @brief Extend the Box.
+ *
+ * Grows the box, so that it also contains the point or the other box.
+ */
+void AABB2::extend(const Vec2& p)
+{
+    lo.x = std::min(lo.x, p.x); lo.y = std::min(lo.y, p.y);
+    hi.x = std::max(hi.x, p.x); hi.y = std::max(hi.y, p.y);
+}
+void AABB2::extend(const AABB2& other)
+{
+    lo.x = std::min(lo.x, other.lo.x); lo.y = std::min(lo.y, other.lo.y);
+    hi.x = std::max(hi.x, other.hi.x); hi.y = std::max(hi.y, other.hi.y);
+}
+///@}
+
+///@{
+/**
+ * @brief Containment.
+ *
+ * True, if the point or the whole other box lies inside this box. The boundary counts as inside.
+ */
+bool AABB2::contains(const Vec2& p) const
+{
+    return (lo.x <= p.x) && (p.x <= hi.x) && (lo.y <= p.y) && (p.y <= hi.y);
+}
+bool AABB2::contains(const AABB2& other) const
+{
+    return (lo.x <= other.lo.x) && (other.hi.x <= hi.x) && (lo.y <= other.lo.y) && (other.hi.y <= hi.y);
+}
+///@}
+
+/**
+ * @brief Overlap Test.
+ *
+ * True, if the two boxes share at least one point. Touching boxes intersect.
+ */
+bool AABB2::intersects(const AABB2& other) const
+{
+    return (lo.x <= other.hi.x) && (other.lo.x <= hi.x) && (lo.y <= other.hi.y) && (other.lo.y <= hi.y);
+}
+
+/**
+ * @brief Ray Test.
+ *
+ * Intersects the ray `origin + t * dir` (t >= 0) with the box using the slab method.
+ * If the ray hits the box, the parameters where it enters and leaves the box are written to `tnear` and `tfar`.
+ * For rays starting inside the box `tnear` is 0.
+ *
+ * @param origin start point of the ray
+ * @param dir direction of the ray, does not need to be normalized
+ * @param [out] tnear ray parameter of the entry point
+ * @param [out] tfar ray parameter of the exit point
+ */
+bool AABB2::hit(const Vec2& origin, const Vec2& dir, Float& tnear, Float& tfar) const
+{
+    tnear = 0.f; tfar = _inf;
+    _slab(origin.x, dir.x, lo.x, hi.x, tnear, tfar);
+    _slab(origin.y, dir.y, lo.y, hi.y, tnear, tfar);
+    return tnear <= tfar;
+}
+
+/**
+ * @brief Distance to a Point.
+ *
+ * The Euclidian distance between `p` and the closest point of the box. Points inside the box have a distance of 0.
+ */
+Float AABB2::distance(const Vec2& p) const
+{
+    const Float dx{ std::max(std::max(lo.x - p.x, p.x - hi.x), 0.f) };
+    const Float dy{ std::max(std::max(lo.y - p.y, p.y - hi.y), 0.f) };
+    return std::sqrt(dx*dx + dy*dy);
+}
+
+// ----------------------------------------------
+// AABB3: Constructors
+
+/**
+ * @brief Corner Constructor.
+ *
+ * Initializes the two corners explicitly. `lo` has to be smaller than `hi` in all coordinates, otherwise the box is empty.
+ */
+AABB3::AABB3(const Vec3& _lo, const Vec3& _hi) : lo(_lo), hi(_hi)
+{}
+
+/**
+ * @brief Point Constructor.
+ *
+ * A box of size 0 that contains only the point `p`.
+ */
+AABB3::AABB3(const Vec3& p) : AABB3(p, p)
+{}
+
+/**
+ * @brief Empty Box (Default Constructor).
+ *
+ * The corners are set to +inf and -inf.
+ */
+AABB3::AABB3() : AABB3(Vec3(_inf), Vec3(-_inf))
+{}
+
+// ----------------------------------------------
+// AABB3: Properties
+
+/// True, if the box does not contain any point.
+bool AABB3::isEmpty() const
+{
+    return (hi.x < lo.x) || (hi.y < lo.y) || (hi.z < lo.z);
+}
+
+/// Edge lengths of the box.
+Vec3 AABB3::size() const
+{
+    return hi - lo;
+}
+
+/// Center of the box.
+Vec3 AABB3::center() const
+{
+    return .5f * (lo + hi);
+}
+
+// ----------------------------------------------
+// AABB3: Methods
+
+///@{
+/**
+ * @brief Extend the Box.
+ *
+ * Grows the box, so that it also contains the point or the other box.
+ */
+void AABB3::extend(const Vec3& p)
+{
+    lo.x = std::min(lo.x, p.x); lo.y = std::min(lo.y, p.y); lo.z = std::min(lo.z, p.z);
+    hi.x = std::max(hi.x, p.x); hi.y = std::max(hi.y, p.y); hi.z = std::max(hi.z, p.z);
+}
+void AABB3::extend(const AABB3& other)
+{
+    lo.x = std::min(lo.x, other.lo.x); lo.y = std::min(lo.y, other.lo.y); lo.z = std::min(lo.z, other.lo.z);
+    hi.x = std::max(hi.x, other.hi.x); hi.y = std::max(hi.y, other.hi.y); hi.z = std::max(hi.z, other.hi.z);
+}
+///@}
+
+///@{
+/**
+ * @brief Containment.
+ *
+ * True, if the point or the whole other box lies inside this box. The boundary counts as inside.
+ */
+bool AABB3::contains(const Vec3& p) const
+{
+    return (lo.x <= p.x) && (p.x <= hi.x)
+        && (lo.y <= p.y) && (p.y <= hi.y)
+        && (lo.z <= p.z) && (p.z <= hi.z);
+}
+bool AABB3::contains(const AABB3& other) const
+{
+    return (lo.x <= other.lo.x) && (other.hi.x <= hi.x)
+        && (lo.y <= other.lo.y) && (other.hi.y <= hi.y)
+        && (lo.z <= other.lo.z) && (other.hi.z <= hi.z);
+}
+///@}
+
+/**
+ * @brief Overlap Test.
+ *
+ * True, if the two boxes share at least one point. Touching boxes intersect.
+ */
+bool AABB3::intersects(const AABB3& other) const
+{
+    return (lo.x <= other.hi.x) && (other.lo.x <= hi.x)
+        && (lo.y <= other.hi.y) && (other.lo.y <= hi.y)
+        && (lo.z <= other.hi.z) && (other.lo.z <= hi.z);
+}
+
+/**
+ * @brief Ray Test.
+ *
+ * Intersects the ray `origin + t * dir` (t >= 0) with the box using the slab method. See [AABB2::hit](@ref AABB2::hit).
+ */
+bool AABB3::hit(const Vec3& origin, const Vec3& dir, Float& tnear, Float& tfar) const
+{
+    tnear = 0.f; tfar = _inf;
+    _slab(origin.x, dir.x, lo.x, hi.x, tnear, tfar);
+    _slab(origin.y, dir.y, lo.y, hi.y, tnear, tfar);
+    _slab(origin.z, dir.z, lo.z, hi.z, tnear, tfar);
+    return tnear <= tfar;
+}
+
+/**
+ * @brief Distance to a Point.
+ *
+ * The Euclidian distance between `p` and the closest point of the box. Points inside the box have a distance of 0.
+ */
+Float AABB3::distance(const Vec3& p) const
+{
+    const Float dx{ std::max(std::max(lo.x - p.x, p.x - hi.x), 0.f) };
+    const Float dy{ std::max(std::max(lo.y - p.y, p.y - hi.y), 0.f) };
+    const Float dz{ std::max(std::max(lo.z - p.z, p.z - hi.z), 0.f) };
+    return std::sqrt(dx*dx + dy*dy + dz*dz);
+}
+
+// ----------------------------------------------
+// Namespace Methods
+
+///@{
+/**
+ * @brief Union.
+ *
+ * The smallest box that contains both boxes.
+ */
+AABB2 vml::unite(const AABB2& a, const AABB2& b)
+{
+    AABB2 u{ a };
+    u.extend(b);
+    return u;
+}
+AABB3 vml::unite(const AABB3& a, const AABB3& b)
+{
+    AABB3 u{ a };
+    u.extend(b);
+    return u;
+}
+///@}
+
+///@{
+/**
+ * @brief Intersection.
+ *
+ * The box that is covered by both boxes. If they do not overlap the result is empty.
+ */
+AABB2 vml::intersection(const AABB2& a, const AABB2& b)
+{
+    return AABB2(Vec2(std::max(a.lo.x, b.lo.x), std::max(a.lo.y, b.lo.y)),
+                 Vec2(std::min(a.hi.x, b.hi.x), std::min(a.hi.y, b.hi.y)));
+}
+AABB3 vml::intersection(const AABB3& a, const AABB3& b)
+{
+    return AABB3(Vec3(std::max(a.lo.x, b.lo.x), std::max(a.lo.y, b.lo.y), std::max(a.lo.z, b.lo.z)),
+                 Vec3(std::min(a.hi.x, b.hi.x), std::min(a.hi.y, b.hi.y), std::min(a.hi.z, b.hi.z)));
+}
+///@}
+
+/**
+ * @brief Bulk Bounds.
+ *
+ * Computes the bounding box of `n` points. The points are split into chunks that are reduced on several threads, each chunk keeps its minimum and maximum in registers.
+ * An empty input results in an empty box.
+ *
+ * @param points pointer to the first point
+ * @param n number of points
+ */
+///@{
+AABB2 vml::bounds(const Vec2* points, std::size_t n)
+{
+    std::vector<AABB2> partial(chunkCount(n, _grain));
+    parallelFor(n, _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        Float lx{ _inf }, ly{ _inf }, hx{ -_inf }, hy{ -_inf };
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            lx = std::min(lx, points[i].x); hx = std::max(hx, points[i].x);
+            ly = std::min(ly, points[i].y); hy = std::max(hy, points[i].y);
+        }
+        partial[c] = AABB2(Vec2(lx, ly), Vec2(hx, hy));
+    });
+    AABB2 box;
+    for (const AABB2& b : partial) box.extend(b);
+    return box;
+}
+AABB3 vml::bounds(const Vec3* points, std::size_t n)
+{
+    std::vector<AABB3> partial(chunkCount(n, _grain));
+    parallelFor(n, _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        Float lx{ _inf }, ly{ _inf }, lz{ _inf }, hx{ -_inf }, hy{ -_inf }, hz{ -_inf };
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            lx = std::min(lx, points[i].x); hx = std::max(hx, points[i].x);
+            ly = std::min(ly, points[i].y); hy = std::max(hy, points[i].y);
+            lz = std::min(lz, points[i].z); hz = std::max(hz, points[i].z);
+        }
+        partial[c] = AABB3(Vec3(lx, ly, lz), Vec3(hx, hy, hz));
+    });
+    AABB3 box;
+    for (const AABB3& b : partial) box.extend(b);
+    return box;
+}
+AABB2 vml::bounds(const std::vector<Vec2>& points)
+{
+    return bounds(points.data(), points.size());
+}
+AABB3 vml::bounds(const std::vector<Vec3>& points)
+{
+    return bounds(points.data(), points.size());
+}
+///@}
+
+// ----------------------------------------------
+// Debugging
+
+/// Print Overload: prints the two corners.
+std::ostream& ::vml::operator << (std::ostream& os, const AABB2& b)
+{
+    os << "[" << b.lo << "," << b.hi << "]";
+    return os;
+}
+
+/// Print Overload: prints the two corners.
+std::ostream& ::vml::operator << (std::ostream& os, const AABB3& b)
+{
+    os << "[" << b.lo << "," << b.hi << "]";
+    return os;
+}
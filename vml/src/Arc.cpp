@@ -1,4 +1,5 @@
 #include "vml/Arc.h"
+#include "vml/Writer.h"
 
 #include <sstream>
 
@@ -119,6 +120,27 @@ bool Arc::reaches(Float psi) const
     return abs(centralAngle()) >= mod2pi( sign(crv) * (psi - ang) + .5f*pi );
 }
 
+/**
+ * @brief Exakte Bounding Box.
+ *
+ * Die kleinste achsenparallele Box, die den Bogen enthält, ohne ihn zu diskretisieren.
+ * Neben Start- und Endpunkt kommen nur die Punkte bei den absoluten Winkeln 0, 90, 180 und 270 Grad als Extrema in Frage.
+ * Diese werden aufgenommen, falls der Bogen sie [erreicht](@ref reaches).
+ */
+AABB2 Arc::bounds() const
+{
+    AABB2 box{ srt };
+    box.extend(end());
+    // Strecken haben keine weiteren Extrema
+    if (isStraight()) return box;
+    for (int k{0}; k < 4; k++)
+    {
+        const Float psi{ k * .5f*pi };
+        if (reaches(psi)) box.extend(atAngle(psi));
+    }
+    return box;
+}
+
 
 // ----------------------------------------------
 // Punkte auf dem Bogen
@@ -166,6 +188,107 @@ Vec2 Arc::atAngle(Float psi) const
 }
 
 
+/**
+ * @brief Nächster Punkt auf dem Bogen.
+ *
+ * Gibt den Punkt des Bogens zurück, der `p` am nächsten liegt.
+ * Für gekrümmte Bögen ist das der Punkt des Kreises in Richtung von `p`, falls der Bogen diesen [erreicht](@ref reaches), sonst der nähere der beiden Endpunkte.
+ * Für Strecken wird `p` auf die Strecke projiziert.
+ *
+ * @param p ein beliebiger Punkt
+ */
+Vec2 Arc::closestPoint(const Vec2& p) const
+{
+    if (isStraight())
+    {
+        const Float l{ dot(p - srt, polar(ang)) };
+        return atLength((l < 0.f) ? 0.f : (l > lng) ? lng : l);
+    }
+    const Vec2 d{ p - center() };
+    if ((d.x != 0.f || d.y != 0.f) && reaches(std::atan2(d.y, d.x)))
+        return atAngle(std::atan2(d.y, d.x));
+    // sonst liegt der nächste Punkt auf einem der Enden
+    const Vec2 e{ end() };
+    return (distance(p, srt) <= distance(p, e)) ? srt : e;
+}
+
+/**
+ * @brief Bogenlänge eines Punktes.
+ *
+ * Die Länge entlang des Bogens vom Startpunkt bis zum Punkt `p`, Umkehrung von [atLength](@ref atLength).
+ * `p` sollte auf dem Bogen liegen, sonst wird die Länge bis zur Projektion auf die Tangente (Strecken) bzw. bis zum Winkel von `p` (gekrümmte Bögen) zurückgegeben.
+ *
+ * @param p ein Punkt auf dem Bogen
+ */
+Float Arc::lengthAt(const Vec2& p) const
+{
+    if (isStraight()) return dot(p - srt, polar(ang));
+    const Vec2 d{ p - center() };
+    return mod2pi( sign(crv) * (std::atan2(d.y, d.x) - ang) + .5f*pi ) / abs(crv);
+}
+
+/**
+ * @brief Stützpunkt in einer Richtung.
+ *
+ * Der Punkt des Bogens, der in Richtung `dir` am weitesten außen liegt, also `dot(p, dir)` maximiert.
+ * Kandidaten sind Start- und Endpunkt und, falls der Bogen ihn [erreicht](@ref reaches), der Punkt des Kreises beim Winkel von `dir`.
+ *
+ * @param dir Richtung, muss nicht normiert sein
+ */
+Vec2 Arc::supportPoint(const Vec2& dir) const
+{
+    const Vec2 e{ end() };
+    Vec2 best{ (dot(e, dir) > dot(srt, dir)) ? e : srt };
+    if (isStraight()) return best;
+    const Float psi{ std::atan2(dir.y, dir.x) };
+    if (reaches(psi)) best = atAngle(psi);
+    return best;
+}
+
+/**
+ * @brief Schnitt mit einem Strahl.
+ *
+ * Schneidet den Strahl `origin + t * dir` (t >= 0) mit dem Bogen.
+ * Die Strahlparameter der Schnittpunkte werden aufsteigend nach `t` geschrieben, die Anzahl (0, 1 oder 2) wird zurückgegeben.
+ * Berührt der Strahl den Kreis, zählt der Berührpunkt doppelt, damit die Parität beim Zählen von Schnitten erhalten bleibt.
+ * Gekrümmte Bögen werden dazu mit dem korrespondierenden Kreis geschnitten und die Schnittpunkte behalten, die der Bogen [erreicht](@ref reaches).
+ *
+ * @param origin Startpunkt des Strahls
+ * @param dir Richtung des Strahls, muss nicht normiert sein
+ * @param [out] t Speicher für bis zu zwei Strahlparameter
+ */
+int Arc::intersect(const Vec2& origin, const Vec2& dir, Float t[2]) const
+{
+    if (isStraight())
+    {
+        const Vec2 u{ polar(ang) };
+        const Float denom{ dir.x * u.y - dir.y * u.x };
+        if (denom == 0.f) return 0;
+        const Vec2 w{ srt - origin };
+        const Float tr{ (w.x * u.y - w.y * u.x) / denom };
+        const Float s{ (w.x * dir.y - w.y * dir.x) / denom };
+        if (tr < 0.f || s < 0.f || s > lng) return 0;
+        t[0] = tr;
+        return 1;
+    }
+    const Vec2 c{ center() };
+    const Vec2 f{ origin - c };
+    const Float r{ radius() };
+    const Float a{ dot(dir, dir) };
+    const Float b{ dot(f, dir) };
+    const Float disc{ b*b - a*(dot(f, f) - r*r) };
+    if (disc < 0.f || a == 0.f) return 0;
+    const Float root{ std::sqrt(disc) };
+    int n{ 0 };
+    for (const Float tr : { (-b - root) / a, (-b + root) / a })
+    {
+        if (tr < 0.f) continue;
+        const Vec2 q{ f + tr * dir };
+        if (reaches(std::atan2(q.y, q.x))) t[n++] = tr;
+    }
+    return n;
+}
+
 
 // ----------------------------------------------
 // Methoden
@@ -185,37 +308,191 @@ void Arc::transform(Float rot, Vec2 off = Vec2(0.f))
     srt = srt.rotated(rot) + off;
 }
 
+/**
+ * @brief Affine Transformation mit vorberechneter Rotation.
+ *
+ * Wie [transform(rot, off)](@ref transform), aber Kosinus und Sinus stammen aus dem Transform2 und werden nicht für jeden Bogen neu berechnet.
+ *
+ * @param T Rotation und Versatz
+ */
+void Arc::transform(const Transform2& T)
+{
+    ang += T.angle();
+    srt = T.point(srt);
+}
+
+/**
+ * @brief Parallelbogen (Offset).
+ *
+ * Verschiebt den Bogen um `distance` rechtwinklig zur Laufrichtung, positive Abstände nach rechts.
+ * Der Parallelbogen ist wieder ein Bogen um denselben Mittelpunkt, mit der Krümmung `crv/(1 + distance*crv)` und demselben Mittelpunktswinkel.
+ * Wird der Faktor `1 + distance*crv` kleiner oder gleich 0, schrumpft der Radius auf 0 und der Bogen kollabiert: die Länge des Ergebnisses ist dann 0.
+ *
+ * @param distance Abstand, positiv nach rechts
+ */
+Arc Arc::offset(Float distance) const
+{
+    const Float scale{ 1.f + distance * crv };
+    const Vec2 srt2{ srt + distance * polar(ang - .5f*pi) };
+    if (scale <= 0.f) return Arc(srt2.x, srt2.y, ang, 0.f, 0.f);
+    return Arc(srt2.x, srt2.y, ang, crv / scale, lng * scale);
+}
+
+/**
+ * @brief Anzahl der Abtastungen.
+ *
+ * Die Anzahl der Punkte, die [discretize](@ref discretize) bei der Auflösung `res` erzeugt: [centralAngle](@ref centralAngle)/`res`, aber mindestens der Startpunkt.
+ * Gerade Bögen liefern nur ihren Startpunkt.
+ *
+ * @param res Auflösung in Radiant, Abstand zwischen zwei diskreten Abtastungen. Default = 0.3.
+ */
+int Arc::samples(Float res) const
+{
+    if (isStraight()) return 1;
+    const int N{ static_cast<int>(abs(centralAngle())/res) };
+    return (N < 1) ? 1 : N;
+}
+
+/**
+ * @brief Abtastung in einen vorallokierten Speicher.
+ *
+ * Schreibt `n` Punkte bei den Längen `i * lng/n` (i = 0, ..., n-1) nach `output`, inklusive des Startpunktes aber exklusive des Endpunktes.
+ * Siehe [sample(output, n, first, step)](@ref sample).
+ *
+ * @param [out] output Zeiger auf Speicher für mindestens `n` Punkte
+ * @param n Anzahl der Abtastungen
+ */
+void Arc::sample(Vec2* output, int n) const
+{
+    if (n <= 0) return;
+    sample(output, n, 0.f, lng / n);
+}
+
+/**
+ * @brief Äquidistante Abtastung ab einer Länge.
+ *
+ * Schreibt `n` Punkte bei den Längen `first + i * step` (i = 0, ..., n-1) nach `output`.
+ * Anstatt [atLength](@ref atLength) für jeden Punkt aufzurufen (Mittelpunkt, Kosinus und Sinus pro Punkt), wird der Radiusvektor mit einer festen Drehung weitergedreht (komplexe Multiplikation).
+ * Dabei laufen vier unabhängige Ketten nebeneinander, die jeweils um vier Schritte drehen. So hängen aufeinanderfolgende Punkte nicht voneinander ab und der Compiler kann die Schleife vektorisieren.
+ * Alle 256 Punkte werden die Ketten exakt neu aufgesetzt, damit sich Rundungsfehler in Länge und Phase nicht aufsummieren.
+ *
+ * @param [out] output Zeiger auf Speicher für mindestens `n` Punkte
+ * @param n Anzahl der Abtastungen
+ * @param first Länge der ersten Abtastung
+ * @param step Abstand zweier Abtastungen entlang des Bogens
+ */
+void Arc::sample(Vec2* output, int n, Float first, Float step) const
+{
+    if (n <= 0) return;
+
+    // Strecken werden linear abgetastet
+    if (isStraight())
+    {
+        const Vec2 u{ polar(ang) };
+        for (int i{0}; i < n; i++)
+        {
+            const Float l{ first + i * step };
+            output[i] = Vec2(srt.x + l * u.x, srt.y + l * u.y);
+        }
+        return;
+    }
+
+    const int lanes{ 4 };
+    const int anchor{ 64 * lanes };
+    const Vec2 c{ center() };
+    const Vec2 r0{ srt - c };
+    const Float phi0{ crv * first };
+    const Float dphi{ crv * step };
+    // Drehung um vier Schritte als Einheitsvektor (cos, sin)
+    const Vec2 rotation{ polar(lanes * dphi) };
+
+    Float rx[lanes], ry[lanes];
+    int i{ 0 };
+    while (i < n)
+    {
+        // setze die Ketten exakt auf
+        for (int k{0}; k < lanes; k++)
+        {
+            const Vec2 r{ r0.rotated(phi0 + (i + k) * dphi) };
+            rx[k] = r.x; ry[k] = r.y;
+        }
+        const int stop{ (n < i + anchor) ? n : i + anchor };
+        for (; i + lanes <= stop; i += lanes)
+        {
+            for (int k{0}; k < lanes; k++)
+            {
+                output[i + k] = Vec2(c.x + rx[k], c.y + ry[k]);
+                const Float x{ rx[k] * rotation.x - ry[k] * rotation.y };
+                ry[k] = rx[k] * rotation.y + ry[k] * rotation.x;
+                rx[k] = x;
+            }
+        }
+        // Rest am Ende des Bogens
+        for (int k{0}; i < stop; i++, k++)
+            output[i] = Vec2(c.x + rx[k], c.y + ry[k]);
+    }
+    // der Startpunkt wird exakt übernommen
+    if (first == 0.f) output[0] = srt;
+}
+
 /**
  * @brief Diskretisierung (zu einem Polygon)
  *
  * Wandelt den Bogen in ein Polygon (`std::vector` aus `Vec2`) in dem an diskreten Längen zwischen 0 und `lng` abgetastet wird.
- * Die Abtastung erfolgt über die Funktion [at_length](@ref at_length).
  * Die Auflösung wird in Radiant als Winkel angegeben, damit starktgekrümmte Bögen öfter und wenig gekrümmte Bögen seltener abgetastet werden und die Polygone skalierungs unabhängig sind.
  * Dadurch ist die Anzahl der Abtastungen gleich [central_angle](@ref central_angle)/´res´. Die Abtastung ist inklusive des Startpunktes aber exklusive des Endpunktes.
  * Gerade Segemente Segmente liefern dadurch nur ihren Startpunkt.
+ * Die Punkte werden an `output` angehängt. Der Speicher wird einmal für die exakte Anzahl vergrößert und dann mit [sample](@ref sample) befüllt.
  *
  * @param [out] output Referrenz zu einem Vec2-vector, in welchem die Abtastungen gespeichert werden sollen.
  * @param res Auflösung in Radiant, Abstand zwischen zwei diskreten Abtastungen. Default = 0.3.
  */
 void Arc::discretize(std::vector<Vec2> &output, Float res) const
 {
-    // speicher die Startposition in jedem Fall
-    output.push_back(srt);
-
-    // für gerade Bögen wird abgebrochen
-    if (isStraight()) return;
-    
-    // berechne die Anzahl der Abtastungen
-    int N{ static_cast<int>(abs(centralAngle())/res) };
-    // berechne den Abstand zwischen zwei Abtastungen
-    Float increment{ lng / N };
-    
-    // taste den Bogen mit at_length ab
-    for (int i{1}; i<N; i++)
-    {
-        Vec2 p{ atLength(i * increment) };
-        output.push_back(p);
-    }
+    const int N{ samples(res) };
+    const std::size_t offset{ output.size() };
+    output.resize(offset + N);
+    sample(output.data() + offset, N);
+}
+
+/**
+ * @brief Anzahl der Abtastungen bei begrenzter Abweichung.
+ *
+ * Die kleinste Anzahl gleichmäßig verteilter Punkte, bei der keine Sehne des Polygons weiter als `tolerance` vom Bogen abweicht.
+ * Die Abweichung einer Sehne über den Winkel θ ist die Pfeilhöhe r(1 - cos(θ/2)), daraus folgt der größte erlaubte Winkel θ = 2 acos(1 - `tolerance`/r).
+ * Er wird als 4 asin(sqrt(`tolerance`/2r)) berechnet, was für kleine Toleranzen nicht auf 0 rundet.
+ * Bögen mit großem Radius werden so seltener, kleine Bögen öfter abgetastet als bei einer festen Winkelauflösung.
+ * Gerade Bögen liefern nur ihren Startpunkt.
+ *
+ * @param tolerance maximaler Abstand zwischen Polygon und Bogen (> 0)
+ */
+int Arc::adaptiveSamples(Float tolerance) const
+{
+    assert(tolerance > 0.f);
+    if (isStraight()) return 1;
+    const Float x{ tolerance * abs(crv) };
+    // ab einer Toleranz vom Durchmesser ist jede Sehne erlaubt, acos(1 - x) = 2 asin(sqrt(x/2)) bleibt auch für kleine x > 0 positiv
+    const Float maxAngle{ (x >= 2.f) ? 2.f * pi : 4.f * std::asin(std::sqrt(.5f * x)) };
+    const int N{ static_cast<int>(std::ceil(abs(centralAngle()) / maxAngle)) };
+    return (N < 1) ? 1 : N;
+}
+
+/**
+ * @brief Diskretisierung mit begrenzter Abweichung (zu einem Polygon)
+ *
+ * Wie [discretize](@ref discretize), aber die Anzahl der Abtastungen wird mit [adaptiveSamples](@ref adaptiveSamples) aus Radius und Zentriwinkel bestimmt,
+ * so dass das Polygon (inklusive der Sehne zum Endpunkt) höchstens `tolerance` vom Bogen abweicht.
+ * Die Punkte werden an `output` angehängt.
+ *
+ * @param [out] output Referrenz zu einem Vec2-vector, in welchem die Abtastungen gespeichert werden sollen.
+ * @param tolerance maximaler Abstand zwischen Polygon und Bogen (> 0)
+ */
+void Arc::discretizeAdaptive(std::vector<Vec2> &output, Float tolerance) const
+{
+    const int N{ adaptiveSamples(tolerance) };
+    const std::size_t offset{ output.size() };
+    output.resize(offset + N);
+    sample(output.data() + offset, N);
 }
 
 /**
@@ -227,19 +504,9 @@ void Arc::discretize(std::vector<Vec2> &output, Float res) const
  */
 std::string Arc::TikZ() const
 {
-    std::stringstream ss;
-    if (isStraight())
-    {
-        Vec2 e{ end() };
-        ss << "-- (" << e.x << "," << e.y << ") ";
-    }
-    else
-    {
-        Float sa{ degree(ang - sign(crv) * .5f*pi) };
-        Float ea{ sa + degree(centralAngle()) };
-        ss << "arc(" << sa << ":" << ea << ":" << radius() << ") ";
-    }
-    return ss.str();
+    TikZWriter writer;
+    writer.write(*this);
+    return writer.str();
 }
 
 
@@ -0,0 +1,298 @@
+#include "vml/ArcBVH.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::nth_element
+#include <limits>
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// minimal number of queries per thread in the batch queries
+const std::size_t _grain{ 1 << 10 };
+
+/// positive infinity
+const Float _inf{ std::numeric_limits<Float>::infinity() };
+
+/// maximal depth of the traversal stack, the median split keeps the tree balanced
+const int _stackSize{ 64 };
+
+/// Direction of the containment ray, the same as in [ArcShape::contains](@ref ArcShape::contains) (see [probeAngle](@ref Arc::probeAngle)).
+const Vec2 _probe{ polar(Arc::probeAngle) };
+
+// ----------------------------------------------
+// Constructors
+
+/**
+ * @brief Shape Constructor.
+ *
+ * Copies the arcs of `shape` and builds the tree top down: each node is split at the median of the box centers along its longest axis, until at most [leafSize](@ref leafSize) arcs remain.
+ */
+ArcBVH::ArcBVH(const ArcShape& shape)
+{
+    const int n{ static_cast<int>(shape.size()) };
+    std::vector<AABB2> boxes(n);
+    index.resize(n);
+    for (int i{0}; i < n; i++)
+    {
+        boxes[i] = shape[i].bounds();
+        index[i] = i;
+    }
+    tree.reserve(n > 0 ? 2 * (n / leafSize + 1) : 0);
+    if (n > 0) build(0, n, boxes);
+
+    arcs.reserve(n);
+    for (std::size_t i : index) arcs.push_back(shape[i]);
+}
+
+/**
+ * @brief Recursive Construction.
+ *
+ * Creates the node for the arcs `index[begin, end)` and its subtree, returns the index of the node.
+ *
+ * @param boxes bounds of the arcs, in shape order
+ */
+int ArcBVH::build(int begin, int end, const std::vector<AABB2>& boxes)
+{
+    const int id{ static_cast<int>(tree.size()) };
+    tree.push_back(Node{ AABB2(), begin, end - begin, 0 });
+
+    AABB2 box, centers;
+    for (int i{begin}; i < end; i++)
+    {
+        box.extend(boxes[index[i]]);
+        centers.extend(boxes[index[i]].center());
+    }
+    tree[id].box = box;
+    if (end - begin <= leafSize) return id;
+
+    // split at the median along the longest axis of the centers
+    const Vec2 extent{ centers.size() };
+    const bool alongX{ extent.x >= extent.y };
+    const int mid{ (begin + end) / 2 };
+    std::nth_element(index.begin() + begin, index.begin() + mid, index.begin() + end,
+        [&](std::size_t a, std::size_t b)
+        {
+            return alongX ? boxes[a].center().x < boxes[b].center().x
+                          : boxes[a].center().y < boxes[b].center().y;
+        });
+
+    tree[id].count = 0;
+    build(begin, mid, boxes);
+    const int right{ build(mid, end, boxes) };
+    tree[id].right = right;
+    return id;
+}
+
+// ----------------------------------------------
+// Properties
+
+/// Number of arcs.
+std::size_t ArcBVH::size() const
+{
+    return arcs.size();
+}
+
+/// The nodes in depth first order, the root is the first node.
+const std::vector<ArcBVH::Node>& ArcBVH::nodes() const
+{
+    return tree;
+}
+
+/// Bounds of the whole shape (the box of the root node).
+AABB2 ArcBVH::bounds() const
+{
+    return tree.empty() ? AABB2() : tree.front().box;
+}
+
+// ----------------------------------------------
+// Queries
+
+/**
+ * @brief Exact Closest Point.
+ *
+ * The point of the shape that is closest to `p`.
+ * The tree is traversed nearer child first, subtrees whose box is farther away than the best arc found so far are skipped.
+ *
+ * @param p query point
+ * @param [out] arc optional, receives the position of the closest arc in the shape
+ */
+Vec2 ArcBVH::closestPoint(const Vec2& p, std::size_t* arc) const
+{
+    Vec2 best{ p };
+    Float bestDist{ _inf };
+    std::size_t bestArc{ 0 };
+    if (tree.empty()) return best;
+
+    int stack[_stackSize];
+    int top{ 0 };
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& node{ tree[stack[--top]] };
+        if (node.box.distance(p) >= bestDist) continue;
+        if (node.count > 0)
+        {
+            for (int i{node.first}; i < node.first + node.count; i++)
+            {
+                const Vec2 q{ arcs[i].closestPoint(p) };
+                const Float d{ vml::distance(p, q) };
+                if (d < bestDist) { bestDist = d; best = q; bestArc = index[i]; }
+            }
+            continue;
+        }
+        // push the farther child first, so the nearer one is visited next
+        const int left{ static_cast<int>(&node - tree.data()) + 1 };
+        const bool leftFirst{ tree[left].box.distance(p) <= tree[node.right].box.distance(p) };
+        stack[top++] = leftFirst ? node.right : left;
+        stack[top++] = leftFirst ? left : node.right;
+    }
+    if (arc) *arc = bestArc;
+    return best;
+}
+
+/// Distance between `p` and the closest point of the shape.
+Float ArcBVH::distance(const Vec2& p) const
+{
+    return vml::distance(p, closestPoint(p));
+}
+
+/**
+ * @brief Signed Distance.
+ *
+ * The [distance](@ref distance) to the shape, negative if `p` lies inside of the shape.
+ */
+Float ArcBVH::signedDistance(const Vec2& p) const
+{
+    const Float d{ distance(p) };
+    return contains(p) ? -d : d;
+}
+
+/**
+ * @brief Point in Shape Test.
+ *
+ * Counts the crossings of a ray starting at `p` with the arcs, the point is inside if the number is odd (even-odd rule).
+ * Only the arcs whose boxes are hit by the ray are tested.
+ */
+bool ArcBVH::contains(const Vec2& p) const
+{
+    if (tree.empty() || !tree.front().box.contains(p)) return false;
+
+    int crossings{ 0 };
+    int stack[_stackSize];
+    int top{ 0 };
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const int id{ stack[--top] };
+        const Node& node{ tree[id] };
+        Float tnear, tfar;
+        if (!node.box.hit(p, _probe, tnear, tfar)) continue;
+        if (node.count > 0)
+        {
+            Float t[2];
+            for (int i{node.first}; i < node.first + node.count; i++)
+                crossings += arcs[i].intersect(p, _probe, t);
+            continue;
+        }
+        stack[top++] = node.right;
+        stack[top++] = id + 1;
+    }
+    return crossings % 2 == 1;
+}
+
+/**
+ * @brief Ray Intersection.
+ *
+ * Finds the first intersection of the ray `origin + t * dir` (t >= 0) with the shape.
+ * Subtrees whose box is entered behind the best hit found so far are skipped.
+ *
+ * @param origin start point of the ray
+ * @param dir direction of the ray, does not need to be normalized
+ * @param [out] t ray parameter of the first hit, untouched if there is none
+ * @param [out] arc optional, receives the position of the hit arc in the shape
+ * @return `true` if the ray hits the shape
+ */
+bool ArcBVH::intersect(const Vec2& origin, const Vec2& dir, Float& t, std::size_t* arc) const
+{
+    Float best{ _inf };
+    std::size_t bestArc{ 0 };
+    if (tree.empty()) return false;
+
+    int stack[_stackSize];
+    int top{ 0 };
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const int id{ stack[--top] };
+        const Node& node{ tree[id] };
+        Float tnear, tfar;
+        if (!node.box.hit(origin, dir, tnear, tfar) || tnear > best) continue;
+        if (node.count > 0)
+        {
+            Float hits[2];
+            for (int i{node.first}; i < node.first + node.count; i++)
+                if (arcs[i].intersect(origin, dir, hits) > 0 && hits[0] < best)
+                {
+                    best = hits[0];
+                    bestArc = index[i];
+                }
+            continue;
+        }
+        stack[top++] = node.right;
+        stack[top++] = id + 1;
+    }
+    if (best == _inf) return false;
+    t = best;
+    if (arc) *arc = bestArc;
+    return true;
+}
+
+// ----------------------------------------------
+// Batch Queries
+
+/**
+ * @brief Batch Closest Points.
+ *
+ * [closestPoint](@ref closestPoint) for every point, the queries are split over all threads. `output` is resized to the number of points.
+ */
+void ArcBVH::closestPoints(const std::vector<Vec2>& points, std::vector<Vec2>& output) const
+{
+    output.resize(points.size());
+    parallelFor(points.size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = closestPoint(points[i]);
+    });
+}
+
+/**
+ * @brief Batch Signed Distances.
+ *
+ * [signedDistance](@ref signedDistance) for every point, the queries are split over all threads. `output` is resized to the number of points.
+ */
+void ArcBVH::signedDistances(const std::vector<Vec2>& points, std::vector<Float>& output) const
+{
+    output.resize(points.size());
+    parallelFor(points.size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = signedDistance(points[i]);
+    });
+}
+
+/**
+ * @brief Batch Ray Intersection.
+ *
+ * [intersect](@ref intersect) for every pair of `origins` and `dirs`, the queries are split over all threads.
+ * `t` is resized to the number of rays and receives the parameter of the first hit, or infinity if the ray misses the shape.
+ */
+void ArcBVH::intersect(const std::vector<Vec2>& origins, const std::vector<Vec2>& dirs, std::vector<Float>& t) const
+{
+    assert(origins.size() == dirs.size());
+    t.resize(origins.size());
+    parallelFor(origins.size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++)
+            if (!intersect(origins[i], dirs[i], t[i])) t[i] = _inf;
+    });
+}
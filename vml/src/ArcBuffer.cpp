@@ -0,0 +1,248 @@
+#include "vml/ArcBuffer.h"
+#include "vml/parallel.h"
+
+#include <limits>
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// minimal number of arcs per thread in the batch kernels
+const std::size_t _grain{ 1 << 14 };
+
+/**
+ * @brief Transform Kernel.
+ *
+ * Rotates and moves the arcs `[begin, end)` of the buffer. Cosine and sine come from the Transform2, the loop body has no branches and no calls, so it vectorizes.
+ */
+static void _transform(ArcBuffer& buffer, std::size_t begin, std::size_t end, const Transform2& T)
+{
+    const Float c{ T.rotation().x };
+    const Float s{ T.rotation().y };
+    const Float ox{ T.offset().x };
+    const Float oy{ T.offset().y };
+    const Float rot{ T.angle() };
+    Float* x{ buffer.x.data() };
+    Float* y{ buffer.y.data() };
+    Float* ang{ buffer.ang.data() };
+    for (std::size_t i{begin}; i < end; i++)
+    {
+        const Float xi{ x[i] };
+        const Float yi{ y[i] };
+        x[i] = c * xi - s * yi + ox;
+        y[i] = s * xi + c * yi + oy;
+        ang[i] += rot;
+    }
+}
+
+// ----------------------------------------------
+// Constructors
+
+/// Default Constructor: an empty buffer without shapes.
+ArcBuffer::ArcBuffer() : offsets{ 0 }
+{}
+
+// ----------------------------------------------
+// Properties
+
+/// Number of arcs of all shapes.
+std::size_t ArcBuffer::size() const
+{
+    return x.size();
+}
+
+/// Number of shapes.
+std::size_t ArcBuffer::shapes() const
+{
+    return offsets.size() - 1;
+}
+
+/// First arc of a shape.
+std::size_t ArcBuffer::begin(std::size_t shape) const
+{
+    return offsets[shape];
+}
+
+/// One past the last arc of a shape.
+std::size_t ArcBuffer::end(std::size_t shape) const
+{
+    return offsets[shape + 1];
+}
+
+// ----------------------------------------------
+// Memory
+
+/// Reserves memory for `arcs` arcs in `shapes` shapes.
+void ArcBuffer::reserve(std::size_t arcs, std::size_t shapes)
+{
+    x.reserve(arcs); y.reserve(arcs); ang.reserve(arcs); crv.reserve(arcs); lng.reserve(arcs);
+    offsets.reserve(shapes + 1);
+}
+
+/// Removes all arcs and shapes, the capacity is kept.
+void ArcBuffer::clear()
+{
+    x.clear(); y.clear(); ang.clear(); crv.clear(); lng.clear();
+    offsets.assign(1, 0);
+}
+
+/**
+ * @brief Allocate Shapes.
+ *
+ * Appends `count` new shapes with `arcs` default initialized arcs each and returns the index of the first new shape.
+ * The arrays grow only once, the arcs can then be written directly into them, e.g. by a batch constructor.
+ */
+std::size_t ArcBuffer::allocate(std::size_t arcs, std::size_t count)
+{
+    const std::size_t first{ shapes() };
+    const std::size_t n{ size() + arcs * count };
+    x.resize(n); y.resize(n); ang.resize(n); crv.resize(n); lng.resize(n, 1.f);
+    for (std::size_t k{0}; k < count; k++) offsets.push_back(offsets.back() + arcs);
+    return first;
+}
+
+/// Appends a copy of `shape` and returns its index.
+std::size_t ArcBuffer::push_back(const ArcShape& shape)
+{
+    const std::size_t first{ size() };
+    const std::size_t index{ allocate(shape.size()) };
+    for (std::size_t i{0}; i < shape.size(); i++) set(first + i, shape[i]);
+    return index;
+}
+
+// ----------------------------------------------
+// Views
+
+/// Reads the i-th arc back as an Arc.
+Arc ArcBuffer::operator[] (std::size_t i) const
+{
+    return Arc(x[i], y[i], ang[i], crv[i], lng[i]);
+}
+
+/// Overwrites the i-th arc.
+void ArcBuffer::set(std::size_t i, const Arc& a)
+{
+    x[i] = a.srt.x; y[i] = a.srt.y; ang[i] = a.ang; crv[i] = a.crv; lng[i] = a.lng;
+}
+
+/// Copies a shape out of the buffer.
+ArcShape ArcBuffer::shape(std::size_t k) const
+{
+    ArcShape s;
+    shape(k, s);
+    return s;
+}
+
+/// Copies a shape out of the buffer into `s`, reusing its memory.
+void ArcBuffer::shape(std::size_t k, ArcShape& s) const
+{
+    s.resize(end(k) - begin(k));
+    for (std::size_t i{begin(k)}; i < end(k); i++) s[i - begin(k)] = (*this)[i];
+}
+
+// ----------------------------------------------
+// Batch Kernels
+
+/**
+ * @brief Transform all Arcs.
+ *
+ * Rotates and moves every arc of every shape by `T`. Cosine and sine are computed once (in the Transform2), not per arc.
+ */
+void ArcBuffer::transform(const Transform2& T)
+{
+    parallelFor(size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        _transform(*this, begin, end, T);
+    });
+}
+
+/// Transforms the arcs of a single shape.
+void ArcBuffer::transform(std::size_t shape, const Transform2& T)
+{
+    _transform(*this, begin(shape), end(shape), T);
+}
+
+/**
+ * @brief Transform every Shape.
+ *
+ * Applies `perShape[k]` to the arcs of shape `k`, the shapes are split over all threads.
+ */
+void ArcBuffer::transform(const std::vector<Transform2>& perShape)
+{
+    assert(perShape.size() == shapes());
+    const std::size_t grain{ std::max<std::size_t>(1, _grain * shapes() / std::max<std::size_t>(size(), 1)) };
+    parallelFor(shapes(), grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t k{begin}; k < end; k++) _transform(*this, this->begin(k), this->end(k), perShape[k]);
+    });
+}
+
+/**
+ * @brief End Points of all Arcs.
+ *
+ * Evaluates [Arc::end](@ref Arc::end) for every arc, `output` is resized to the number of arcs.
+ */
+void ArcBuffer::ends(std::vector<Vec2>& output) const
+{
+    output.resize(size());
+    parallelFor(size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            const Float k{ crv[i] };
+            if (k == 0.f)
+            {
+                output[i] = Vec2(x[i] + lng[i] * std::cos(ang[i]), y[i] + lng[i] * std::sin(ang[i]));
+                continue;
+            }
+            // end = srt + (polar(ang + lng*crv - pi/2) - polar(ang - pi/2)) / crv
+            const Float phi{ ang[i] + lng[i] * k };
+            output[i] = Vec2(x[i] + (std::sin(phi) - std::sin(ang[i])) / k,
+                             y[i] - (std::cos(phi) - std::cos(ang[i])) / k);
+        }
+    });
+}
+
+/**
+ * @brief Centers of all Arcs.
+ *
+ * Evaluates [Arc::center](@ref Arc::center) for every arc, `output` is resized to the number of arcs.
+ * ATTENTION: straight arcs have no center, their entries are infinite.
+ */
+void ArcBuffer::centers(std::vector<Vec2>& output) const
+{
+    output.resize(size());
+    parallelFor(size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++)
+            output[i] = Vec2(x[i] - std::sin(ang[i]) / crv[i], y[i] + std::cos(ang[i]) / crv[i]);
+    });
+}
+
+/**
+ * @brief Extent of every Shape along an Axis.
+ *
+ * The interval of `dot(p, axis)` over every shape, like [ArcShape::extent](@ref ArcShape::extent), in one pass over the arcs.
+ * `output` is resized to the number of shapes, a preallocated vector is reused.
+ */
+void ArcBuffer::extents(const Vec2& axis, std::vector<Interval>& output) const
+{
+    output.resize(shapes());
+    const std::size_t grain{ std::max<std::size_t>(1, _grain * shapes() / std::max<std::size_t>(size(), 1)) };
+    parallelFor(shapes(), grain, [&](std::size_t, std::size_t first, std::size_t last)
+    {
+        for (std::size_t k{first}; k < last; k++)
+        {
+            Float lo{ std::numeric_limits<Float>::infinity() };
+            Float hi{ -lo };
+            for (std::size_t i{begin(k)}; i < end(k); i++)
+            {
+                const Arc a{ (*this)[i] };
+                lo = std::min(lo, dot(a.supportPoint(-axis), axis));
+                hi = std::max(hi, dot(a.supportPoint(axis), axis));
+            }
+            output[k] = Interval(lo, hi);
+        }
+    });
+}
@@ -0,0 +1,284 @@
+#include "vml/ArcFit.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::max, std::min
+#include <limits>
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// positive infinity
+const Float _inf{ std::numeric_limits<Float>::infinity() };
+
+/// Angle of the direction `v`.
+static Float _angle(const Vec2& v)
+{
+    return std::atan2(v.y, v.x);
+}
+
+/**
+ * @brief Tangent Estimate.
+ *
+ * Direction of the polyline at `points[i]`: the central difference for inner points,
+ * at the first point the chord to the next point, corrected by half of the turn to the following chord (exact for evenly spaced points on a circle).
+ */
+static Float _tangent(const Vec2* points, std::size_t n, std::size_t i)
+{
+    if (n < 2) return 0.f;
+    if (i > 0 && i + 1 < n) return _angle(points[i+1] - points[i-1]);
+    if (i + 1 >= n) return _angle(points[n-1] - points[n-2]);
+    const Float first{ _angle(points[1] - points[0]) };
+    if (n < 3) return first;
+    const Float turn{ mod2pi(_angle(points[2] - points[1]) - first + pi) - pi };
+    return first - .5f * turn;
+}
+
+/// share of the tolerance that is left for representing the arcs in `Float`
+const Float _share{ .1f };
+
+/// relative rounding error of [Arc](@ref Arc), measured with some margin
+const Float _resolution{ 4.f * std::numeric_limits<Float>::epsilon() };
+
+/**
+ * @brief Representation Error.
+ *
+ * The arc from `p` in the direction `ang` to `q = p + d`, where `dn` is the distance of `q` from the tangent and `dd = |d|²`, has the radius `dd / (2 |dn|)`.
+ * [Arc](@ref Arc) evaluates curved arcs through their center, which lies a radius away, so their points are only resolved up to about
+ * `resolution (|p| + (5 + |ang|) radius)`. Its chord instead deviates from the arc by the sagitta, about `|dn| / 4`.
+ * [_arc](@ref _arc) takes the chord if `|dn| / 4` is not larger than the error of the curved arc, so it loses the smaller of both.
+ *
+ * @return error of the curved arc, infinite for `dn = 0`
+ */
+static Float _curved(Float pn, Float ang, Float dn, Float dd)
+{
+    return _resolution * (pn + (5.f + abs(ang)) * dd / (2.f * abs(dn)));
+}
+
+/**
+ * @brief Interpolating Arc.
+ *
+ * The arc that starts at `p` in the direction `ang` and ends at `q`. It turns by twice the angle between the direction and the chord (tangent-chord angle),
+ * its length follows from the chord length, which stays exact for almost straight arcs.
+ * Arcs that would be resolved worse than their chord (see `_curved`) are replaced by the chord, which keeps the end exact and only breaks the tangent by the tiny tangent-chord angle.
+ * The points must lie in front of `p`.
+ */
+static Arc _arc(const Vec2& p, Float ang, const Vec2& q)
+{
+    const Vec2 t{ polar(ang) };
+    const Vec2 d{ q - p };
+    const Float dd{ d.x*d.x + d.y*d.y };
+    const Float dn{ t.x*d.y - t.y*d.x };
+    if (dd == 0.f) return Arc(p.x, p.y, ang, 0.f, 0.f);
+    if (.25f * abs(dn) <= _curved(p.norm(), ang, dn, dd)) return Arc(p.x, p.y, _angle(d), 0.f, std::sqrt(dd));
+    // sin(half) = dn / |d|, so the length |d| half / sin(half) and the curvature 2 sin(half) / |d| need no division by a small sine
+    const Float half{ std::atan2(dn, t.x*d.x + t.y*d.y) };
+    return Arc(p.x, p.y, ang, 2.f * dn / dd, dd * half / dn);
+}
+
+/**
+ * @brief Coverage Check.
+ *
+ * Checks that all `n` points lie within `tolerance` of the arc, assuming they lie within `tolerance` of its full circle (see `_longest`).
+ * A point `(u, v)` in the frame of the start direction projects to the arc length `atan2(k u, 1 - k v) / k` on the circle, which turns into `u` for straight arcs.
+ * If this lies outside of the arc, the point has to be close to the nearer end point instead.
+ * Unlike [closestPoint](@ref Arc::closestPoint) this needs no center, which is far away and imprecise for almost straight arcs.
+ */
+static bool _covers(const Arc& arc, const Vec2& end, const Vec2* points, std::size_t n, Float tolerance)
+{
+    const Vec2 t{ polar(arc.ang) };
+    const Float k{ arc.crv };
+    for (std::size_t j{0}; j < n; j++)
+    {
+        const Vec2 d{ points[j] - arc.srt };
+        const Float u{ d.x*t.x + d.y*t.y };
+        const Float v{ t.x*d.y - t.y*d.x };
+        const Float s{ (abs(k) * abs(u) > 1e-6f) ? std::atan2(k*u, 1.f - k*v) / k : u };
+        if (s < 0.f && d.norm() > tolerance) return false;
+        if (s > arc.lng && (points[j] - end).norm() > tolerance) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Longest Arc.
+ *
+ * Finds the longest arc that starts at `p` in the direction `ang`, ends on one of the points after `points[i]` and stays within `tolerance` of all points in between.
+ *
+ * All circles that start at `p` in the direction `t` form a one parameter family in the curvature `k`.
+ * A point `q = p + d` lies within `tol` of such a circle if and only if
+ * `k (|d|² - tol²)` lies in `[2 d·n - 2 tol, 2 d·n + 2 tol]`, where `n` is the left normal of `t`.
+ * Every point therefore allows an interval of curvatures. The search intersects these intervals while it walks along the points
+ * and remembers the last point whose interpolating curvature `2 d·n / |d|²` lies in the intersection.
+ * The intervals use all but a [share](@ref _share) of `tolerance`, an end point is only taken if the [representation error](@ref _curved) of its arc fits into this share.
+ *
+ * The search stops as soon as the intersection is empty, a point lies behind the start (that would need more than half a circle),
+ * or the points fall back along `t` by more than `tol`. The last rule ends the search where the polyline reverses,
+ * so the next search only visits those points again that still advance along `t`.
+ *
+ * @return index of the end point, `i` if no point can be reached
+ */
+static std::size_t _longest(const Vec2* points, std::size_t n, std::size_t i, const Vec2& p, Float ang, Float tolerance)
+{
+    const Float tol{ (1.f - _share) * tolerance }, budget{ _share * tolerance };
+    const Float tol2{ tol * tol };
+    const Float pn{ p.norm() };
+    const Vec2 t{ polar(ang) };
+    const Vec2 nrm{ -t.y, t.x };
+
+    Float lo{ -_inf }, hi{ _inf }, ahead{ 0.f };
+    std::size_t best{ i };
+    for (std::size_t j{i+1}; j < n; j++)
+    {
+        const Vec2 d{ points[j] - p };
+        const Float dd{ d.x*d.x + d.y*d.y };
+        const Float u{ d.x*t.x + d.y*t.y };
+        if (u < ahead - tol) break;
+        ahead = std::max(ahead, u);
+        // points within the tolerance of the start constrain nothing
+        if (dd <= tol2) continue;
+        if (u <= 0.f) break;
+        const Float dn{ d.x*nrm.x + d.y*nrm.y };
+        const Float den{ dd - tol2 };
+        lo = std::max(lo, (2.f*dn - 2.f*tol) / den);
+        hi = std::min(hi, (2.f*dn + 2.f*tol) / den);
+        if (lo > hi) break;
+        const Float k{ 2.f*dn / dd };
+        if (k < lo || k > hi) continue;
+        // the error grows along the arc
+        if (std::min(.25f * abs(dn), _curved(pn, ang, dn, dd)) > budget) break;
+        best = j;
+    }
+    return best;
+}
+
+/**
+ * @brief Greedy Arc Spline.
+ *
+ * Fits the points `points[0..n)` with arcs, starting at `points[0]` in the direction `ang`, and appends the arcs to `shape`.
+ * Every arc is the [longest](@ref _longest) one from the end of the previous arc in its end direction, so the arcs are continuous and tangent continuous up to rounding.
+ * Noise can make the inherited direction a bad start, then the arc is compared with the one in the [estimated](@ref _tangent) direction of the points,
+ * and the longer of both is taken. Each arc is checked against its points once more, if it misses one it is replaced by the arc to the first point outside of the tolerance around the start.
+ * Points next to the end of the previous arc are covered by it; if no point after them can be reached in the current direction, the next arc starts towards the following point.
+ *
+ * Each search stops where the points fall back along its start direction, so it only visits again points that advance in this direction.
+ * This keeps the run time linear in the number of points for retraced and noisy polylines as well.
+ *
+ * @param all the complete polyline, for the direction estimate
+ * @param total number of points of the complete polyline
+ * @return direction at the end of the last arc
+ */
+static Float _fit(const Vec2* all, std::size_t total, std::size_t first, std::size_t n, Float ang, Float tolerance, ArcShape& shape)
+{
+    const Vec2* points{ all + first };
+    const Float near{ (1.f - _share) * tolerance };
+    Vec2 start{ points[0] };
+    std::size_t i{ 0 };
+    while (i + 1 < n)
+    {
+        // points next to the start are covered by it, except the last one, which has to be met exactly
+        if (i + 2 < n && (points[i+1] - start).norm() <= near)
+        {
+            i++;
+            continue;
+        }
+
+        std::size_t best{ _longest(points, n, i, start, ang, tolerance) };
+        if (best <= i + 1 && i > 0)
+        {
+            const Float estimate{ _tangent(all, total, first + i) };
+            const std::size_t reach{ _longest(points, n, i, start, estimate, tolerance) };
+            if (reach > best)
+            {
+                best = reach;
+                ang = estimate;
+            }
+        }
+        // nothing reachable in front: turn towards the next point, which then lies straight ahead
+        if (best == i)
+        {
+            ang = _angle(points[i+1] - start);
+            best = std::max(_longest(points, n, i, start, ang, tolerance), i + 1);
+        }
+
+        Arc arc{ _arc(start, ang, points[best]) };
+        // the intervals only bound the distance to the full circle, strongly curved arcs on noisy points can miss a point that lies next to the circle
+        if (best > i + 1 && !_covers(arc, points[best], points + i + 1, best - i - 1, tolerance))
+        {
+            // the points in front of the first one outside of the tolerance lie next to the start, so this arc always covers them
+            std::size_t next{ i + 1 };
+            while (next + 1 < best && (points[next] - start).norm() <= tolerance) next++;
+            best = next;
+            arc = _arc(start, ang, points[best]);
+        }
+        if (arc.lng > 0.f)
+        {
+            shape.push_back(arc);
+            start = arc.end();
+            ang = mod2pi(arc.ang + arc.crv * arc.lng + pi) - pi;
+        }
+        i = best;
+    }
+    return ang;
+}
+
+// ----------------------------------------------
+// Arc Spline Fitting
+
+/**
+ * @brief Arc Spline Fit (Greedy).
+ *
+ * Replaces `shape` by a sequence of arcs that passes through the first and the last point and stays within `tolerance` of every point.
+ * Each arc starts at the end of the previous one and ends on one of the input points, up to the rounding of [Arc](@ref Arc), which the fit keeps below a tenth of `tolerance`.
+ * The arcs are chosen greedily as long as possible, which gives close to the minimal number of arcs for smooth input,
+ * in time linear in the number of points, also for noisy or retraced input (see `_fit`).
+ * The arcs are tangent continuous, except where noise in the points forces a new start direction, where the polyline reverses,
+ * and by a tiny angle where an almost straight arc is replaced by its chord.
+ * Dense scanner data typically shrinks by one to two orders of magnitude.
+ * For a closed outline the first point has to be repeated at the end; the shape is then closed, but only continuous (not tangent continuous) at the first point.
+ * Fewer than two points give an empty shape.
+ *
+ * @param points ordered points of the polyline
+ * @param tolerance maximal distance of a point from the arcs, larger than 0
+ * @param [out] shape resulting arcs
+ */
+void vml::fit(const std::vector<Vec2>& points, Float tolerance, ArcShape& shape)
+{
+    assert(tolerance > 0.f);
+    shape.clear();
+    if (points.size() < 2) return;
+    _fit(points.data(), points.size(), 0, points.size(), _tangent(points.data(), points.size(), 0), tolerance, shape);
+}
+
+/**
+ * @brief Arc Spline Fit (Chunked).
+ *
+ * Parallel version of [fit](@ref fit) for very long polylines. The points are split into chunks of at least `grain` segments,
+ * neighbouring chunks share their boundary point. Every chunk is fitted on its own thread, starting in the [estimated](@ref _tangent) direction of the polyline,
+ * and the arcs are concatenated in order. The result is continuous everywhere up to rounding, tangent continuity is also lost at the chunk boundaries.
+ *
+ * @param points ordered points of the polyline
+ * @param tolerance maximal distance of a point from the arcs, larger than 0
+ * @param [out] shape resulting arcs
+ * @param grain minimal number of segments per chunk
+ */
+void vml::fitChunked(const std::vector<Vec2>& points, Float tolerance, ArcShape& shape, std::size_t grain)
+{
+    assert(tolerance > 0.f);
+    shape.clear();
+    if (points.size() < 2) return;
+
+    const std::size_t segments{ points.size() - 1 };
+    std::vector<ArcShape> parts(chunkCount(segments, grain));
+    parallelFor(segments, grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        const Vec2* p{ points.data() };
+        _fit(p, points.size(), begin, end - begin + 1, _tangent(p, points.size(), begin), tolerance, parts[c]);
+    });
+
+    std::size_t total{ 0 };
+    for (const ArcShape& part : parts) total += part.size();
+    shape.reserve(total);
+    for (const ArcShape& part : parts) shape.insert(shape.end(), part.begin(), part.end());
+}
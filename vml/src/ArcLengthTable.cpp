@@ -0,0 +1,202 @@
+#include "vml/ArcLengthTable.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::upper_bound
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// minimal number of lookups per thread in the batch lookup
+const std::size_t _grain{ 1 << 12 };
+
+/**
+ * @brief Prefix Search.
+ *
+ * Index of the range `[prefix[i], prefix[i+1])` that contains `x`. Empty ranges (arcs of length 0) are skipped.
+ */
+static std::size_t _search(const std::vector<Float>& prefix, Float x)
+{
+    const std::size_t i( std::upper_bound(prefix.begin(), prefix.end(), x) - prefix.begin() );
+    const std::size_t last{ prefix.size() - 2 };
+    return (i == 0) ? 0 : (i - 1 > last) ? last : i - 1;
+}
+
+// ----------------------------------------------
+// Constructors
+
+/**
+ * @brief Shape Constructor.
+ *
+ * Copies the arcs of `shape` and accumulates their lengths and absolute central angles.
+ */
+ArcLengthTable::ArcLengthTable(const ArcShape& shape) :
+    arcs(shape.begin(), shape.end()),
+    lengths(shape.size() + 1, 0.f),
+    angles(shape.size() + 1, 0.f)
+{
+    for (std::size_t i{0}; i < arcs.size(); i++)
+    {
+        lengths[i + 1] = lengths[i] + arcs[i].lng;
+        angles[i + 1] = angles[i] + abs(arcs[i].centralAngle());
+    }
+}
+
+// ----------------------------------------------
+// Properties
+
+/// Number of arcs.
+std::size_t ArcLengthTable::size() const
+{
+    return arcs.size();
+}
+
+/// Total length of the shape (perimeter).
+Float ArcLengthTable::length() const
+{
+    return lengths.back();
+}
+
+/// Sum of the absolute central angles of all arcs.
+Float ArcLengthTable::angle() const
+{
+    return angles.back();
+}
+
+/// Length of the shape up to the start of the arc at position `arc`.
+Float ArcLengthTable::lengthAt(std::size_t arc) const
+{
+    return lengths[arc];
+}
+
+/// Sum of the absolute central angles up to the start of the arc at position `arc`.
+Float ArcLengthTable::angleAt(std::size_t arc) const
+{
+    return angles[arc];
+}
+
+// ----------------------------------------------
+// Lookup
+
+/**
+ * @brief Arc at a Length.
+ *
+ * Position of the arc that contains the point at length `s` along the shape, found by binary search. `s` wraps around the [length](@ref length).
+ */
+std::size_t ArcLengthTable::locate(Float s) const
+{
+    if (arcs.empty() || length() <= 0.f) return 0;
+    return _search(lengths, mod(s, length()));
+}
+
+/**
+ * @brief Point @ Length.
+ *
+ * The point at length `s` along the whole shape, measured from the start of the first arc. `s` wraps around the [length](@ref length).
+ */
+Vec2 ArcLengthTable::atLength(Float s) const
+{
+    if (arcs.empty()) return Vec2(0.f);
+    if (length() <= 0.f) return arcs.front().srt;
+    s = mod(s, length());
+    const std::size_t i{ _search(lengths, s) };
+    return arcs[i].atLength(s - lengths[i]);
+}
+
+/**
+ * @brief Point @ Parameter.
+ *
+ * Normalized arc length parametrization: `t = 0` is the start, `t = 1` the full perimeter. Equal steps in `t` are equal steps along the shape, also on straight arcs.
+ */
+Vec2 ArcLengthTable::atParameter(Float t) const
+{
+    return atLength(t * length());
+}
+
+/**
+ * @brief Point @ Turning Angle.
+ *
+ * The point where the absolute central angles, summed from the start of the shape, reach `phi`.
+ * This is the distribution used by [ArcShape::discretize(points, numberOfPoints)](@ref ArcShape::discretize), straight arcs take no angle and are skipped.
+ */
+Vec2 ArcLengthTable::atAngle(Float phi) const
+{
+    if (arcs.empty()) return Vec2(0.f);
+    if (angle() <= 0.f) return arcs.front().srt;
+    phi = mod(phi, angle());
+    const std::size_t i{ _search(angles, phi) };
+    return arcs[i].atLength((phi - angles[i]) / abs(arcs[i].crv));
+}
+
+// ----------------------------------------------
+// Batch Sampling
+
+/**
+ * @brief Uniform Sampling by Length.
+ *
+ * Writes `n` points with equal distance `length()/n` along the shape, starting at length `first`.
+ * The arcs are walked once, each arc writes its points with the [rotation recurrence](@ref Arc::sample), so no lookup and no sine or cosine per point is needed.
+ *
+ * @param [out] output pointer to memory for at least `n` points
+ * @param n number of points
+ * @param first length of the first point, wraps around the [length](@ref length)
+ */
+void ArcLengthTable::sample(Vec2* output, int n, Float first) const
+{
+    if (n <= 0 || arcs.empty()) return;
+    if (length() <= 0.f)
+    {
+        for (int i{0}; i < n; i++) output[i] = arcs.front().srt;
+        return;
+    }
+
+    const Float step{ length() / n };
+    const Float s0{ mod(first, length()) };
+    std::size_t k{ _search(lengths, s0) };
+    // length of all full laps before arc k
+    Float lap{ 0.f };
+    int i{ 0 };
+    while (i < n)
+    {
+        // all points before the end of arc k
+        const Float end{ lap + lengths[k + 1] };
+        int m{ static_cast<int>(std::ceil((end - s0) / step)) };
+        m = (m < i) ? i : (m > n) ? n : m;
+        if (m > i) arcs[k].sample(output + i, m - i, s0 + i * step - (lap + lengths[k]), step);
+        i = m;
+        if (++k == arcs.size())
+        {
+            k = 0;
+            lap += length();
+        }
+    }
+}
+
+/**
+ * @brief Uniform Discretization by Length.
+ *
+ * Appends `numberOfPoints` points with equal distance along the shape to `points`, starting with the start point of the first arc.
+ * Unlike [ArcShape::discretize(points, numberOfPoints)](@ref ArcShape::discretize), the points are distributed by length, so straight arcs get their share too.
+ */
+void ArcLengthTable::discretize(std::vector<Vec2>& points, int numberOfPoints) const
+{
+    if (numberOfPoints <= 0) return;
+    const std::size_t offset{ points.size() };
+    points.resize(offset + numberOfPoints);
+    sample(points.data() + offset, numberOfPoints);
+}
+
+/**
+ * @brief Batch Point @ Length.
+ *
+ * [atLength](@ref atLength) for every length in `s`, split over all threads. `output` is resized to the number of lengths.
+ */
+void ArcLengthTable::atLength(const std::vector<Float>& s, std::vector<Vec2>& output) const
+{
+    output.resize(s.size());
+    parallelFor(s.size(), _grain, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = atLength(s[i]);
+    });
+}
@@ -1,6 +1,11 @@
 #include "vml/ArcShape.h"
+#include "vml/Intersection.h"
+#include "vml/Writer.h"
+#include "vml/parallel.h"
 
+#include <algorithm> // std::max
 #include <sstream>
+#include <limits>
 #include <numeric> // std::accumulate
 
 using namespace vml;
@@ -9,13 +14,145 @@ using namespace vml;
  * @brief Affine Transformation (Rotation und Verschiebung).
  *
  * Tranformiert die gesammte Kreisbogenform, indem [transform](@name Arc.transfrom) für jeden Bogen aufgeführt wird.
+ * Kosinus und Sinus werden dabei nur einmal für die ganze Form berechnet (siehe [transform(T)](@ref transform)).
  *
  * @param rot Rotationswinkel
  * @param off Versatz (Offset)
  */
 void ArcShape::transform(Float rot, Vec2 off)
 {
-    for (Arc& a : (*this)) a.transform(rot, off);
+    transform(Transform2(rot, off));
+}
+
+/**
+ * @brief Affine Transformation mit vorberechneter Rotation.
+ *
+ * Transformiert alle Bögen mit demselben Transform2, wodurch Kosinus und Sinus nur einmal für die gesamte Form berechnet werden.
+ *
+ * @param T Rotation und Versatz
+ */
+void ArcShape::transform(const Transform2& T)
+{
+    for (Arc& a : (*this)) a.transform(T);
+}
+
+/**
+ * @brief Verbindungsbogen.
+ *
+ * Der Bogen, der am Ende von `prev` tangential anschließt und im Punkt `q` endet.
+ * An Ecken einer Form ergibt das die runde Verbindung um die Ecke (Kreis mit dem Offset-Abstand als Radius).
+ */
+static Arc _join(const Arc& prev, const Vec2& q)
+{
+    const Vec2 p{ prev.end() };
+    const Float a{ prev.ang + prev.centralAngle() };
+    const Vec2 w{ q - p };
+    const Vec2 t{ polar(a) };
+    const Float chord2{ dot(w, w) };
+    // Krümmung des Kreises durch p (Tangente t) und q
+    const Float k{ 2.f * (t.x * w.y - t.y * w.x) / chord2 };
+    if (k == 0.f) return Arc(p.x, p.y, a, 0.f, std::sqrt(chord2));
+    const Float turn{ 2.f * std::atan2(t.x * w.y - t.y * w.x, dot(t, w)) };
+    return Arc(p.x, p.y, a, k, turn / k);
+}
+
+/**
+ * @brief Parallelform (Offset).
+ *
+ * Verschiebt die Kontur um `distance`, positive Abstände nach rechts der Laufrichtung, also nach außen bei Formen gegen den Uhrzeigersinn (wie [Cashew](@ref Cashew)).
+ * Jeder Bogen wird exakt [verschoben](@ref Arc::offset), die Form bleibt also eine Kreisbogenform.
+ * Tangential anschließende Bögen schließen auch nach dem Verschieben aneinander an. An den übrigen Übergängen gilt:
+ *  - öffnet sich eine Lücke (konvexe Ecke), wird sie mit einem runden Verbindungsbogen geschlossen,
+ *  - überlappen sich die Nachbarn (konkave Ecke), werden sie bis zu ihrem Schnittpunkt gekürzt.
+ * Bögen, deren Radius beim Verschieben auf 0 schrumpft, kollabieren und werden entfernt, ihre Nachbarn werden wie an einer Ecke verbunden.
+ * Globale Selbstüberschneidungen (z.B. bei großen Abständen nach innen an schmalen Stellen) werden nicht entfernt.
+ *
+ * @param distance Abstand, positiv nach außen
+ */
+ArcShape ArcShape::offset(Float distance) const
+{
+    // verschiebe alle Bögen, von kollabierten Bögen bleibt nur ihr Drehwinkel am Übergang
+    ArcShape arcs;
+    std::vector<Float> dropped;
+    arcs.reserve(size());
+    dropped.reserve(size());
+    Float turn{ 0.f };
+    for (const Arc& a : (*this))
+    {
+        if (1.f + distance * a.crv <= 0.f)
+        {
+            turn += a.centralAngle();
+            continue;
+        }
+        arcs.push_back(a.offset(distance));
+        dropped.push_back(turn);
+        turn = 0.f;
+    }
+    if (arcs.empty()) return arcs;
+    // kollabierte Bögen am Ende liegen vor dem ersten Bogen
+    dropped.front() += turn;
+
+    // Übergang i liegt zwischen Bogen i-1 und Bogen i, die Form ist geschlossen
+    const std::size_t n{ arcs.size() };
+    const Float eps{ 1e-5f * (1.f + abs(distance)) };
+    std::vector<Arc> joins(n, Arc(0.f, 0.f, 0.f, 0.f, 0.f));
+    for (std::size_t i{0}; i < n; i++)
+    {
+        Arc& prev{ arcs[(i + n - 1) % n] };
+        Arc& next{ arcs[i] };
+        const Vec2 p{ prev.end() };
+        if (vml::distance(p, next.srt) <= eps) continue;
+
+        // Drehung am Übergang: Ecke (auf (-pi, pi]) plus kollabierte Bögen
+        const Float corner{ next.ang - (prev.ang + prev.centralAngle()) - dropped[i] };
+        const Float bend{ mod2pi(corner + pi) - pi + dropped[i] };
+        if (bend * distance > 0.f)
+        {
+            // konvex: die Lücke wird rund geschlossen
+            joins[i] = _join(prev, next.srt);
+            continue;
+        }
+
+        // konkav: kürze beide Bögen bis zu ihrem Schnittpunkt nahe des Übergangs
+        Vec2 points[2];
+        const int count{ intersect(prev, next, points) };
+        if (count == 0)
+        {
+            joins[i] = _join(prev, next.srt);
+            continue;
+        }
+        const Vec2 mid{ .5f * (p + next.srt) };
+        const Vec2 x{ (count == 2 && vml::distance(points[1], mid) < vml::distance(points[0], mid)) ? points[1] : points[0] };
+        prev.lng = prev.lengthAt(x);
+        const Float l{ next.lengthAt(x) };
+        next.srt = x;
+        next.ang += next.crv * l;
+        next.lng -= l;
+    }
+
+    ArcShape shape;
+    shape.reserve(2 * n);
+    for (std::size_t i{0}; i < n; i++)
+    {
+        if (joins[i].lng != 0.f) shape.push_back(joins[i]);
+        shape.push_back(arcs[i]);
+    }
+    return shape;
+}
+
+/**
+ * @brief Mehrere Parallelformen.
+ *
+ * Berechnet die [Parallelform](@ref offset) für jeden Abstand in `distances`, verteilt auf alle Threads.
+ * `output` wird auf die Anzahl der Abstände gebracht.
+ */
+void ArcShape::offset(const std::vector<Float>& distances, std::vector<ArcShape>& output) const
+{
+    output.resize(distances.size());
+    parallelFor(distances.size(), 16, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = offset(distances[i]);
+    });
 }
 
 /**
@@ -24,35 +161,186 @@ void ArcShape::transform(Float rot, Vec2 off)
  * Bestimmt welche Punkte der Form am tiefsten liegen, also die kleinste y-Koordinate haben.
  * Es wird eine Liste möglicher Kandidaten bestimmt und zurückgegeben.
  * Jeder Bogen der List darf einen Kandidaten liefern.
+ * Sonderfall von [extremePoints](@ref extremePoints) für die Richtung (0, -1).
  */
 std::vector<Vec2> ArcShape::lowestPoints() const
 {
     // erstelle eine leere Punkte liste
     std::vector<Vec2> points{};
-    
+    extremePoints(Vec2(0.f, -1.f), points);
+    return points;
+}
+
+/**
+ * @brief Die äußersten Punkte in einer Richtung.
+ *
+ * Hängt für jeden gekrümmten Bogen, der den Winkel von `dir` erreicht, den Punkt seines Kreises in dieser Richtung an `points` an.
+ * Das sind die Kandidaten, an denen die Form in Richtung `dir` eine waagrechte Tangente hat (lokale Extrema).
+ *
+ * @param dir Richtung, muss nicht normiert sein
+ * @param [out] points Liste, an die die Kandidaten angehängt werden
+ */
+void ArcShape::extremePoints(const Vec2& dir, std::vector<Vec2>& points) const
+{
+    const Float psi{ std::atan2(dir.y, dir.x) };
     for (const Arc& a : (*this))
     {
-        // gekrümmte Bögen, die den Winkel -90° erreichen liefern einen Kandidaten.
-        if (!a.isStraight() && a.reaches(-.5f*pi))
-            points.push_back( a.atAngle(-.5f*pi) );
+        // gekrümmte Bögen, die den Winkel psi erreichen liefern einen Kandidaten.
+        if (!a.isStraight() && a.reaches(psi))
+            points.push_back( a.atAngle(psi) );
     }
-    
-    return points;
+}
+
+/**
+ * @brief Stützpunkt der Form.
+ *
+ * Der Punkt der Form, der in Richtung `dir` am weitesten außen liegt (globales Maximum von `dot(p, dir)`), siehe [Arc::supportPoint](@ref Arc::supportPoint).
+ * Bei mehreren gleich weit außen liegenden Punkten wird der erste zurückgegeben.
+ * Eine leere Form hat keinen Stützpunkt, sie darf nicht übergeben werden; [support](@ref support) und [extent](@ref extent) sind dagegen auch für leere Formen definiert.
+ */
+Vec2 ArcShape::supportPoint(const Vec2& dir) const
+{
+    assert(!empty());
+    Vec2 best{ 0.f };
+    Float value{ -std::numeric_limits<Float>::infinity() };
+    for (const Arc& a : (*this))
+    {
+        const Vec2 p{ a.supportPoint(dir) };
+        if (dot(p, dir) > value) { value = dot(p, dir); best = p; }
+    }
+    return best;
+}
+
+/**
+ * @brief Stützfunktion der Form.
+ *
+ * `h(dir) = max dot(p, dir)` über alle Punkte der Form. Die Stützfunktion beschreibt die konvexe Hülle der Form vollständig.
+ * Für eine leere Form ist das Maximum -inf.
+ */
+Float ArcShape::support(const Vec2& dir) const
+{
+    Float value{ -std::numeric_limits<Float>::infinity() };
+    for (const Arc& a : (*this)) value = std::max(value, dot(a.supportPoint(dir), dir));
+    return value;
+}
+
+/**
+ * @brief Ausdehnung entlang einer Achse.
+ *
+ * Das Intervall [min, max] der Projektionen `dot(p, axis)` aller Punkte der Form.
+ * Für eine normierte Achse ist die Größe des Intervalls die Breite der Form in dieser Richtung.
+ * Eine leere Form liefert das leere Intervall [inf, -inf], wie die leere [Bounding Box](@ref AABB2::AABB2).
+ */
+Interval ArcShape::extent(const Vec2& axis) const
+{
+    return Interval(-support(-axis), support(axis));
+}
+
+/**
+ * @brief Exakte Bounding Box.
+ *
+ * Vereinigt die analytisch bestimmten [Bounding Boxes](@ref Arc::bounds) aller Bögen. Es wird nicht diskretisiert.
+ */
+AABB2 ArcShape::bounds() const
+{
+    AABB2 box{};
+    for (const Arc& a : (*this)) box.extend(a.bounds());
+    return box;
+}
+
+/// Fläche der Form, siehe [moments](@ref moments).
+Float ArcShape::area() const
+{
+    return moments().area;
+}
+
+/// Umfang der Form, die Summe aller Bogenlängen.
+Float ArcShape::perimeter() const
+{
+    Float sum{ 0.f };
+    for (const Arc& a : (*this)) sum += a.lng;
+    return sum;
+}
+
+/// Flächenschwerpunkt der Form, siehe [moments](@ref moments).
+Vec2 ArcShape::centroid() const
+{
+    return moments().centroid;
+}
+
+/**
+ * @brief Exakte Flächenmomente.
+ *
+ * Berechnet Fläche, Schwerpunkt und zweite Flächenmomente der geschlossenen Form in O(Bögen), ohne zu diskretisieren.
+ * Siehe [moments(arcs, n)](@ref vml::moments).
+ */
+Moments ArcShape::moments() const
+{
+    return vml::moments(data(), size());
+}
+
+/**
+ * @brief Liegt ein Punkt innerhalb der Form?
+ *
+ * Zählt die Schnitte eines Strahls von `p` aus mit allen Bögen (siehe [intersect](@ref Arc::intersect)), bei einer ungeraden Anzahl liegt `p` innerhalb.
+ * Der Strahl zeigt in die schiefe Richtung [probeAngle](@ref Arc::probeAngle), wie bei [ArcBVH::contains](@ref ArcBVH::contains).
+ * Für viele Abfragen auf großen Formen ist [ArcBVH](@ref ArcBVH) schneller.
+ *
+ * @param p ein beliebiger Punkt
+ */
+bool ArcShape::contains(const Vec2& p) const
+{
+    const Vec2 probe{ polar(Arc::probeAngle) };
+    int crossings{ 0 };
+    Float t[2];
+    for (const Arc& a : (*this)) crossings += a.intersect(p, probe, t);
+    return crossings % 2 == 1;
 }
 
 /**
  * @brief Diskretisierung (zu einem Polygon).
  *
- * Erstellt eine Punkteliste (`std::vector<Vec2>`), welche durch das Aufrufen von [discretize](@name Arc.discretize) für jeden Bogen gefüll wird.
- * ACHTUNG: Die List wird als Pointer zurückgegeben, vergiss nicht die Daten nach dem Bnutzen wieder zu löschen.
+ * Erweitert eine Punkteliste (`std::vector<Vec2>`) um die Abtastungen aller Bögen, wie bei [discretize](@name Arc.discretize).
+ * Die Liste wird nur einmal auf die exakte Größe gebracht, danach schreibt jeder Bogen mit [sample](@name Arc.sample) direkt in seinen Abschnitt.
  *
  * @param res Winkelauflüsung. Wird an [discretize](@name Arc.discretize()) weitergereicht.
  */
 void ArcShape::discretize(std::vector<Vec2>& points, Float res) const
 {
-    // lass jeden Bogen die List befüllen
+    // bestimme die exakte Anzahl an Punkten und vergrößere die Liste nur einmal
+    std::size_t total{ points.size() };
+    for (const Arc& a : (*this)) total += a.samples(res);
+    std::size_t offset{ points.size() };
+    points.resize(total);
+    // lass jeden Bogen seinen Abschnitt der Liste befüllen
     for (const Arc& a : (*this))
-        a.discretize(points, res);
+    {
+        const int N{ a.samples(res) };
+        a.sample(points.data() + offset, N);
+        offset += N;
+    }
+}
+
+/**
+ * @brief Diskretisierung mit begrenzter Abweichung (zu einem Polygon).
+ *
+ * Erweitert eine Punkteliste um die Abtastungen aller Bögen, wie bei [discretizeAdaptive](@name Arc.discretizeAdaptive).
+ * Jeder Bogen bekommt genau so viele Punkte, dass das geschlossene Polygon höchstens `tolerance` von der Form abweicht.
+ *
+ * @param tolerance maximaler Abstand zwischen Polygon und Form. Wird an [adaptiveSamples](@name Arc.adaptiveSamples()) weitergereicht.
+ */
+void ArcShape::discretizeAdaptive(std::vector<Vec2>& points, Float tolerance) const
+{
+    std::size_t total{ points.size() };
+    for (const Arc& a : (*this)) total += a.adaptiveSamples(tolerance);
+    std::size_t offset{ points.size() };
+    points.resize(total);
+    for (const Arc& a : (*this))
+    {
+        const int N{ a.adaptiveSamples(tolerance) };
+        a.sample(points.data() + offset, N);
+        offset += N;
+    }
 }
 
 /**
@@ -108,15 +396,13 @@ void ArcShape::discretize(std::vector<Vec2>& points, int numberOfPoints) const
     /// every point in polygon is now set
 }
 
-/// TikZ string
+/// TikZ string, für viele Formen ist ein [TikZWriter](@ref TikZWriter) schneller
 /// @param optionals Optionaler Tikz style, default = "" (schwarzer Strich)
 std::string ArcShape::TikZ(const char* optionals) const
 {
-    std::stringstream ss{};
-    ss << "\\draw[" << optionals << "] " << (*this)[0].srt << " ";
-    for (const Arc& a : (*this)) ss << a.TikZ();
-    ss << ";";
-    return ss.str();
+    TikZWriter writer;
+    writer.write(*this, optionals);
+    return writer.str();
 }
 
 /// debugging PRINT (friend function)
@@ -126,3 +412,123 @@ std::ostream& ::vml::operator<< (std::ostream& os, const ArcShape& S) {
         os << "\t\t" << ++i << ".: " << a;
     return os;
 }
+
+// ----------------------------------------------
+// Batch Methoden
+
+/**
+ * @brief Exakte Flächenmomente einer Bogenkette.
+ *
+ * Die Fläche einer geschlossenen Bogenkette zerfällt in das Polygon der Sehnen (von Start- zu Endpunkt jedes Bogens) und die Kreisabschnitte zwischen Sehne und Bogen.
+ * Für beide gibt es geschlossene Formeln: das Polygon über die Dreiecke zum Bezugspunkt, die Kreisabschnitte als Sektor minus Dreieck im lokalen Koordinatensystem des Bogens, die dann gedreht und verschoben werden.
+ * Kreisabschnitte von Rechtskurven (`crv` < 0) haben negative Fläche, gerade Bögen tragen nur zum Polygon bei.
+ * Gerechnet wird relativ zum Startpunkt des ersten Bogens, damit weit vom Ursprung entfernte Formen keine Genauigkeit verlieren.
+ *
+ * @param arcs Zeiger auf den ersten Bogen
+ * @param n Anzahl der Bögen
+ */
+Moments vml::moments(const Arc* arcs, std::size_t n)
+{
+    Moments m{ 0.f, 0.f, Vec2(0.f), 0.f, 0.f, 0.f };
+    if (n == 0) return m;
+
+    const Vec2 ref{ arcs[0].srt };
+    // Fläche, erste Momente, zweite Momente bezogen auf ref
+    Float A{ 0.f }, Sx{ 0.f }, Sy{ 0.f }, Jxx{ 0.f }, Jyy{ 0.f }, Jxy{ 0.f };
+    for (std::size_t i{0}; i < n; i++)
+    {
+        const Arc& a{ arcs[i] };
+        m.perimeter += a.lng;
+
+        // Dreieck aus ref und Sehne
+        const Vec2 p{ a.srt - ref };
+        const Vec2 q{ a.end() - ref };
+        const Float cross{ p.x * q.y - q.x * p.y };
+        A += cross / 2.f;
+        Sx += (p.x + q.x) * cross / 6.f;
+        Sy += (p.y + q.y) * cross / 6.f;
+        Jxx += (p.x*p.x + p.x*q.x + q.x*q.x) * cross / 12.f;
+        Jyy += (p.y*p.y + p.y*q.y + q.y*q.y) * cross / 12.f;
+        Jxy += (p.x*q.y + 2.f*p.x*p.y + 2.f*q.x*q.y + q.x*p.y) * cross / 24.f;
+
+        if (a.isStraight()) continue;
+
+        // Kreisabschnitt mit halbem Öffnungswinkel al, lokal: u zur Bogenmitte, v senkrecht dazu
+        const Float R{ a.radius() };
+        const Float al{ .5f * a.centralAngle() };
+        const Float sa{ std::sin(al) }, ca{ std::cos(al) };
+        const Float R2{ R*R }, R4{ R2*R2 };
+        const Float area{ R2 * (al - sa*ca) };
+        const Float mu{ 2.f/3.f * R*R2 * sa*sa*sa };
+        const Float juu{ R4/4.f * (al + sa*ca) - R4/2.f * sa*ca*ca*ca };
+        const Float jvv{ R4/4.f * (al - sa*ca) - R4/6.f * sa*sa*sa*ca };
+
+        // Drehung in die Richtung der Bogenmitte und Verschiebung zum Mittelpunkt
+        const Vec2 c{ a.center() - ref };
+        const Vec2 u{ polar(a.ang - sign(a.crv) * .5f*pi + al) };
+        const Float mx{ mu * u.x }, my{ mu * u.y };
+        A += area;
+        Sx += area * c.x + mx;
+        Sy += area * c.y + my;
+        Jxx += area * c.x*c.x + 2.f * c.x * mx + juu * u.x*u.x + jvv * u.y*u.y;
+        Jyy += area * c.y*c.y + 2.f * c.y * my + juu * u.y*u.y + jvv * u.x*u.x;
+        Jxy += area * c.x*c.y + c.x * my + c.y * mx + (juu - jvv) * u.x*u.y;
+    }
+
+    m.area = A;
+    if (A == 0.f)
+    {
+        m.centroid = ref;
+        return m;
+    }
+    const Vec2 g{ Sx / A, Sy / A };
+    m.centroid = g + ref;
+    m.xx = Jxx - A * g.x*g.x;
+    m.yy = Jyy - A * g.y*g.y;
+    m.xy = Jxy - A * g.x*g.y;
+    return m;
+}
+
+/**
+ * @brief Flächenmomente vieler Formen.
+ *
+ * Berechnet die [Flächenmomente](@ref moments) jeder Form, verteilt auf alle Threads. `output` wird auf die Anzahl der Formen gebracht.
+ */
+void vml::moments(const std::vector<ArcShape>& shapes, std::vector<Moments>& output)
+{
+    output.resize(shapes.size());
+    parallelFor(shapes.size(), 1 << 10, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = shapes[i].moments();
+    });
+}
+
+/**
+ * @brief Stützpunkte vieler Formen.
+ *
+ * Der [Stützpunkt](@ref ArcShape::supportPoint) jeder Form in Richtung `dir`, verteilt auf alle Threads. Keine der Formen darf leer sein.
+ * `output` wird auf die Anzahl der Formen gebracht, ein vorallokierter Vektor wird dabei nicht neu angelegt.
+ */
+void vml::supportPoints(const std::vector<ArcShape>& shapes, const Vec2& dir, std::vector<Vec2>& output)
+{
+    output.resize(shapes.size());
+    parallelFor(shapes.size(), 1 << 12, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = shapes[i].supportPoint(dir);
+    });
+}
+
+/**
+ * @brief Ausdehnung vieler Formen.
+ *
+ * Die [Ausdehnung](@ref ArcShape::extent) jeder Form entlang `axis`, verteilt auf alle Threads.
+ * `output` wird auf die Anzahl der Formen gebracht, ein vorallokierter Vektor wird dabei nicht neu angelegt.
+ */
+void vml::extents(const std::vector<ArcShape>& shapes, const Vec2& axis, std::vector<Interval>& output)
+{
+    output.resize(shapes.size());
+    parallelFor(shapes.size(), 1 << 12, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++) output[i] = shapes[i].extent(axis);
+    });
+}
@@ -27,13 +27,18 @@ Cashew::Cashew() : Cashew(5.f, 1.f, 1.f, 0.f)
 // Methoden
 
 /**
- * @brief Form konstuieren.
+ * @brief Konstruktions-Kern.
  *
- * Mit dieser Funktion wird die eigentliche Kreisbogenform aus den vier Cashew-Parametern erstellt. Die Mathematik dahinter kann im Anhang meiner Bachelorarbeit nachgelesen werden (Rist V., 2022, Algorithmische Morphologien für autonome Roboter).
+ * Die Mathematik von [construct](@ref Cashew::construct), aber ohne Ausgabe und ohne Speicherverwaltung:
+ * die vier Bögen werden direkt in die fünf Parameter-Arrays geschrieben (je vier Einträge ab den übergebenen Zeigern).
+ * So können die Einzel-Konstruktion und die Batch-Konstruktion in einen [ArcBuffer](@ref ArcBuffer) dieselbe Rechnung benutzen.
+ *
+ * @return `true` wenn die Parameter [gültig](@ref Cashew::isValid) sind und alle Bögen endlich sind
  */
-void Cashew::construct(ArcShape& shape) const
+static bool _construct(const Cashew& c, Float* xs, Float* ys, Float* angs, Float* crvs_out, Float* lngs_out)
 {
     const int num_of_arcs{4};
+    const Float d{ c.d }, r1{ c.r1 }, r2{ c.r2 }, g{ c.g };
     
     // varialbes for initializing arcs
     Vec2  srt {};
@@ -41,9 +46,6 @@ void Cashew::construct(ArcShape& shape) const
     std::array<Float, num_of_arcs> crvs {};
     std::array<Float, num_of_arcs> lngs {};
     
-    // warings
-    if (d < (r1+r2)) std::cerr << "Cashew Warning: d is too short." << std::endl;
-    
     // -------------
     if ( abs(g) < .01f ) // small g snap to zero
     {
@@ -95,20 +97,132 @@ void Cashew::construct(ArcShape& shape) const
     }
     // -------------
     
-    // create an arc shape pointer
-    shape.resize(num_of_arcs);
+    bool finite{ true };
     for (int i{0}; i<num_of_arcs; i++)
     {
         // set arc data
-        shape[i].srt = srt;
-        shape[i].ang = ang;
-        shape[i].crv = crvs[i];
-        shape[i].lng = lngs[i];
+        const Arc a(srt.x, srt.y, ang, crvs[i], lngs[i]);
+        xs[i] = a.srt.x; ys[i] = a.srt.y; angs[i] = a.ang; crvs_out[i] = a.crv; lngs_out[i] = a.lng;
+        finite = finite && std::isfinite(a.srt.x) && std::isfinite(a.srt.y) && std::isfinite(a.crv) && std::isfinite(a.lng);
         
         // update srt and ang
-        srt = shape[i].end();
-        ang += shape[i].centralAngle();
+        srt = a.end();
+        ang += a.centralAngle();
     }
+    return c.isValid() && finite;
+}
+
+/**
+ * @brief Sind die Parameter gültig?
+ *
+ * Eine Cashewform existiert nur für positive Radien, die sich nicht überlappen: `d >= r1 + r2`.
+ */
+bool Cashew::isValid() const
+{
+    return r1 > 0.f && r2 > 0.f && d >= (r1 + r2);
+}
+
+/**
+ * @brief Form konstuieren.
+ *
+ * Mit dieser Funktion wird die eigentliche Kreisbogenform aus den vier Cashew-Parametern erstellt. Die Mathematik dahinter kann im Anhang meiner Bachelorarbeit nachgelesen werden (Rist V., 2022, Algorithmische Morphologien für autonome Roboter).
+ */
+void Cashew::construct(ArcShape& shape) const
+{
+    // warings
+    if (d < (r1+r2)) std::cerr << "Cashew Warning: d is too short." << std::endl;
+    tryConstruct(shape);
+}
+
+/**
+ * @brief Form konstuieren, ohne Warnungen.
+ *
+ * Wie [construct](@ref construct), aber ungültige Parameter werden nicht nach `std::cerr` geschrieben, sondern über den Rückgabewert gemeldet.
+ *
+ * @return `true` wenn die Parameter [gültig](@ref isValid) sind und die Form endlich ist
+ */
+bool Cashew::tryConstruct(ArcShape& shape) const
+{
+    const int num_of_arcs{4};
+    Float x[num_of_arcs], y[num_of_arcs], ang[num_of_arcs], crv[num_of_arcs], lng[num_of_arcs];
+    const bool valid{ _construct(*this, x, y, ang, crv, lng) };
+    
+    // create an arc shape pointer
+    shape.resize(num_of_arcs);
+    for (int i{0}; i<num_of_arcs; i++) shape[i] = Arc(x[i], y[i], ang[i], crv[i], lng[i]);
+    return valid;
+}
+
+// ----------------------------------------------
+// Cashews
+
+/// Anzahl der Parametertupel.
+std::size_t Cashews::size() const
+{
+    return d.size();
+}
+
+/// Verändert die Größe aller vier Parameter-Arrays.
+void Cashews::resize(std::size_t n)
+{
+    d.resize(n); r1.resize(n); r2.resize(n); g.resize(n);
+}
+
+/// Entfernt alle Tupel, die Kapazität bleibt erhalten.
+void Cashews::clear()
+{
+    d.clear(); r1.clear(); r2.clear(); g.clear();
+}
+
+/// Hängt ein Parametertupel an.
+void Cashews::push_back(const Cashew& c)
+{
+    d.push_back(c.d); r1.push_back(c.r1); r2.push_back(c.r2); g.push_back(c.g);
+}
+
+/// Liest das i-te Parametertupel.
+Cashew Cashews::operator[] (std::size_t i) const
+{
+    return Cashew(d[i], r1[i], r2[i], g[i]);
+}
+
+// ----------------------------------------------
+// Batch Konstruktion
+
+/**
+ * @brief Batch-Konstruktion.
+ *
+ * Konstruiert die Formen für alle Parametertupel und hängt sie an `output` an, jede Form mit vier Bögen.
+ * Der Speicher wird einmal für alle Formen vergrößert, danach schreiben die Threads die Bögen direkt in die Arrays des Buffers.
+ * Es werden keine Warnungen ausgegeben: `valid[i]` ist 1 wenn die Form i gültig ist, sonst 0 (siehe [tryConstruct](@ref Cashew::tryConstruct)).
+ *
+ * @param params die Parametertupel
+ * @param [out] output Buffer, an den die Formen angehängt werden
+ * @param [out] valid Gültigkeitsmaske, wird auf die Anzahl der Tupel gebracht
+ * @return Anzahl der gültigen Formen
+ */
+std::size_t vml::construct(const Cashews& params, ArcBuffer& output, std::vector<std::uint8_t>& valid)
+{
+    const std::size_t num_of_arcs{4};
+    const std::size_t n{ params.size() };
+    const std::size_t first{ output.size() };
+    output.allocate(num_of_arcs, n);
+    valid.resize(n);
+
+    std::vector<std::size_t> counts(chunkCount(n, 1 << 12), 0);
+    parallelFor(n, 1 << 12, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            const std::size_t k{ first + num_of_arcs * i };
+            valid[i] = _construct(params[i], &output.x[k], &output.y[k], &output.ang[k], &output.crv[k], &output.lng[k]);
+            counts[c] += valid[i];
+        }
+    });
+
+    std::size_t total{ 0 };
+    for (std::size_t count : counts) total += count;
+    return total;
 }
 
 // ----------------------------------------------
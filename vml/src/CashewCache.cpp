@@ -0,0 +1,177 @@
+#include "vml/CashewCache.h"
+
+#include <algorithm> // std::rotate
+#include <cmath> // std::llround
+
+using namespace vml;
+
+// ----------------------------------------------
+// Keys
+
+/// Keys are equal if all four quantized parameters are equal.
+bool CashewCache::Key::operator == (const Key& other) const
+{
+    return d == other.d && r1 == other.r1 && r2 == other.r2 && g == other.g;
+}
+
+/// Combines the four quantized parameters (boost::hash_combine).
+std::size_t CashewCache::KeyHash::operator() (const Key& key) const
+{
+    std::size_t h{ 0 };
+    for (const std::int64_t v : { key.d, key.r1, key.r2, key.g })
+        h ^= std::hash<std::int64_t>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+}
+
+// ----------------------------------------------
+// Constructors
+
+/**
+ * @brief Standard Constructor.
+ *
+ * @param capacity maximal number of cached shapes, at least 1
+ * @param tolerance grid spacing of the parameters, Cashews closer than this share a shape
+ */
+CashewCache::CashewCache(std::size_t capacity, Float tolerance) :
+    limit{ capacity > 0 ? capacity : 1 },
+    step{ tolerance },
+    hitCount{ 0 },
+    missCount{ 0 }
+{
+    assert(tolerance > 0.f);
+}
+
+// ----------------------------------------------
+// Lookup
+
+/// Rounds the parameters to the grid.
+CashewCache::Key CashewCache::quantize(const Cashew& c) const
+{
+    return Key{ std::llround(c.d / step), std::llround(c.r1 / step), std::llround(c.r2 / step), std::llround(c.g / step) };
+}
+
+/**
+ * @brief Find or Create an Entry.
+ *
+ * Moves the entry of `c` to the front, builds it on a miss and evicts the least recently used entry if the cache is full.
+ * The caller holds the lock.
+ */
+CashewCache::Entry& CashewCache::lookup(const Cashew& c)
+{
+    const Key key{ quantize(c) };
+    const auto found{ index.find(key) };
+    if (found != index.end())
+    {
+        entries.splice(entries.begin(), entries, found->second);
+        return entries.front();
+    }
+
+    // build the shape from the cell center
+    std::shared_ptr<ArcShape> shape{ std::make_shared<ArcShape>() };
+    Cashew(key.d * step, key.r1 * step, key.r2 * step, key.g * step).tryConstruct(*shape);
+    entries.push_front(Entry{ key, shape, {} });
+    index[key] = entries.begin();
+
+    if (entries.size() > limit)
+    {
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+    return entries.front();
+}
+
+/**
+ * @brief Cached Shape.
+ *
+ * Returns the shape for the grid cell of `c`, building it on the first request.
+ * Invalid parameters are cached as well, no warning is written (see [tryConstruct](@ref Cashew::tryConstruct)).
+ */
+CashewCache::Shape CashewCache::shape(const Cashew& c)
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    const bool known{ index.count(quantize(c)) > 0 };
+    (known ? hitCount : missCount)++;
+    return lookup(c).shape;
+}
+
+/**
+ * @brief Cached Discretization.
+ *
+ * Returns the [discretization](@ref ArcShape::discretize) of the cached shape at the resolution `res`, computing it on the first request.
+ * Every shape keeps the discretizations of the last [resolutions](@ref resolutions) resolutions that were asked for, the least recently used one is dropped.
+ */
+CashewCache::Points CashewCache::discretization(const Cashew& c, Float res)
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    Entry& e{ lookup(c) };
+    std::vector<std::pair<Float, Points>>& list{ e.discretizations };
+    for (std::size_t i{0}; i < list.size(); i++)
+        if (list[i].first == res)
+        {
+            hitCount++;
+            std::rotate(list.begin(), list.begin() + i, list.begin() + i + 1);
+            return list.front().second;
+        }
+
+    missCount++;
+    std::shared_ptr<std::vector<Vec2>> points{ std::make_shared<std::vector<Vec2>>() };
+    e.shape->discretize(*points, res);
+    if (list.size() == resolutions) list.pop_back();
+    list.emplace(list.begin(), res, points);
+    return points;
+}
+
+// ----------------------------------------------
+// Properties
+
+/// Number of cached shapes.
+std::size_t CashewCache::size() const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return entries.size();
+}
+
+/// Maximal number of cached shapes.
+std::size_t CashewCache::capacity() const
+{
+    return limit;
+}
+
+/// Grid spacing of the parameters.
+Float CashewCache::tolerance() const
+{
+    return step;
+}
+
+/// Number of lookups (shapes and discretizations) that were answered from the cache.
+std::size_t CashewCache::hits() const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return hitCount;
+}
+
+/// Number of lookups (shapes and discretizations) that had to build their data.
+std::size_t CashewCache::misses() const
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    return missCount;
+}
+
+// ----------------------------------------------
+// Methods
+
+/// Removes all entries, shared pointers handed out before stay valid.
+void CashewCache::clear()
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    entries.clear();
+    index.clear();
+}
+
+/// Sets the hit and miss counters to 0.
+void CashewCache::resetCounters()
+{
+    std::lock_guard<std::mutex> lock{ mutex };
+    hitCount = 0;
+    missCount = 0;
+}
@@ -0,0 +1,149 @@
+#include "vml/EdgeIndex.h"
+
+#include <cstdint>
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// Finalizer of SplitMix64, spreads the bits of both indices over the whole word.
+inline std::uint64_t _mix(std::uint64_t x)
+{
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27; x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+// ----------------------------------------------
+// Constructors
+
+/// Empty index, no slots are allocated before the first insertion.
+EdgeIndex::EdgeIndex() : used{ 0 }
+{}
+
+// ----------------------------------------------
+// Size
+
+/// Number of distinct `(parent, child)` pairs.
+std::size_t EdgeIndex::size() const
+{
+    return used;
+}
+
+/// Removes all entries and frees the slots.
+void EdgeIndex::clear()
+{
+    slots.clear();
+    slots.shrink_to_fit();
+    used = 0;
+}
+
+/// Allocates the slots for `keys` distinct pairs, so that inserting them does not rehash.
+void EdgeIndex::reserve(std::size_t keys)
+{
+    std::size_t capacity{ 16 };
+    while (capacity < 2 * keys) capacity *= 2;
+    if (capacity > slots.size()) rehash(capacity);
+}
+
+// ----------------------------------------------
+// Lookup
+
+/// First slot to probe for a pair.
+std::size_t EdgeIndex::home(Index parent, Index child) const
+{
+    return static_cast<std::size_t>(_mix(parent * 0x9e3779b97f4a7c15ull ^ child)) & (slots.size() - 1);
+}
+
+/// Slot of a pair, or the empty slot where it would be inserted. Requires at least one slot.
+std::size_t EdgeIndex::slot(Index parent, Index child) const
+{
+    const std::size_t mask{ slots.size() - 1 };
+    std::size_t s{ home(parent, child) };
+    while (slots[s].parent != NoN && (slots[s].parent != parent || slots[s].child != child)) s = (s + 1) & mask;
+    return s;
+}
+
+/// Position of an edge from `parent` to `child` in the edge list of `parent`, `NoN` if there is none.
+EdgeIndex::Index EdgeIndex::find(Index parent, Index child) const
+{
+    if (slots.empty()) return NoN;
+    const Slot& s{ slots[slot(parent, child)] };
+    return (s.parent == NoN) ? NoN : s.position;
+}
+
+/// Number of edges from `parent` to `child`.
+std::size_t EdgeIndex::count(Index parent, Index child) const
+{
+    if (slots.empty()) return 0;
+    const Slot& s{ slots[slot(parent, child)] };
+    return (s.parent == NoN) ? 0 : s.count;
+}
+
+// ----------------------------------------------
+// Modification
+
+/// Adds an edge at `position`. For a parallel edge only the count grows, the stored position is kept.
+void EdgeIndex::insert(Index parent, Index child, Index position)
+{
+    assert(parent != NoN);
+    if (2 * (used + 1) > slots.size()) rehash(slots.empty() ? 16 : 2 * slots.size());
+    Slot& s{ slots[slot(parent, child)] };
+    if (s.parent != NoN)
+    {
+        s.count++;
+        return;
+    }
+    s = Slot{ parent, child, position, 1 };
+    used++;
+}
+
+/// Tells the index that an edge moved from position `from` to `to`, e.g. after a removal swapped it into a gap.
+void EdgeIndex::move(Index parent, Index child, Index from, Index to)
+{
+    if (slots.empty()) return;
+    Slot& s{ slots[slot(parent, child)] };
+    if (s.parent != NoN && s.position == from) s.position = to;
+}
+
+/**
+ * @brief Removes one Edge.
+ *
+ * Decrements the count of the pair and removes its entry when it drops to 0.
+ * Empty slots are filled by shifting back the following entries of the probe sequence.
+ *
+ * @return number of remaining edges from `parent` to `child`, the caller has to [move](@ref move) the stored position to one of them if it is not 0
+ */
+std::size_t EdgeIndex::erase(Index parent, Index child)
+{
+    if (slots.empty()) return 0;
+    const std::size_t mask{ slots.size() - 1 };
+    std::size_t hole{ slot(parent, child) };
+    if (slots[hole].parent == NoN) return 0;
+    if (--slots[hole].count > 0) return slots[hole].count;
+
+    // backward shift: move every following entry, whose home lies cyclically at or before the hole, into the hole
+    for (std::size_t s{ (hole + 1) & mask }; slots[s].parent != NoN; s = (s + 1) & mask)
+    {
+        const std::size_t h{ home(slots[s].parent, slots[s].child) };
+        if (((s - h) & mask) >= ((s - hole) & mask))
+        {
+            slots[hole] = slots[s];
+            hole = s;
+        }
+    }
+    slots[hole].parent = NoN;
+    used--;
+    return 0;
+}
+
+/// Moves all entries into a table with `capacity` slots.
+void EdgeIndex::rehash(std::size_t capacity)
+{
+    std::vector<Slot> old(capacity, Slot{ NoN, NoN, NoN, 0 });
+    old.swap(slots);
+    for (const Slot& s : old)
+        if (s.parent != NoN) slots[slot(s.parent, s.child)] = s;
+}
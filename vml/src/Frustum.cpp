@@ -0,0 +1,267 @@
+#include "vml/Frustum.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::copy
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// minimal number of points per thread in the batch pipeline
+const std::size_t _grain{ 1 << 14 };
+
+/**
+ * @brief Chunk Compaction.
+ *
+ * The batch kernels write the kept elements of every chunk to the front of the chunk's own index range.
+ * This moves the kept elements of all chunks together, so that the result is contiguous and still in input order.
+ *
+ * @param data the array to compact
+ * @param begins first index of every chunk
+ * @param kept number of kept elements of every chunk
+ * @return total number of kept elements
+ */
+template<typename T>
+std::size_t _compact(std::vector<T>& data, const std::vector<std::size_t>& begins, const std::vector<std::size_t>& kept)
+{
+    std::size_t total{ 0 };
+    for (std::size_t c{0}; c < begins.size(); c++)
+    {
+        if (begins[c] != total)
+            std::copy(data.begin() + begins[c], data.begin() + begins[c] + kept[c], data.begin() + total);
+        total += kept[c];
+    }
+    data.resize(total);
+    return total;
+}
+
+// ----------------------------------------------
+// Points3
+
+/// Number of points.
+std::size_t Points3::size() const
+{
+    return x.size();
+}
+
+/// Resizes all three coordinate arrays.
+void Points3::resize(std::size_t n)
+{
+    x.resize(n); y.resize(n); z.resize(n);
+}
+
+/// Removes all points, the capacity is kept.
+void Points3::clear()
+{
+    x.clear(); y.clear(); z.clear();
+}
+
+/// Appends a point.
+void Points3::push_back(const Vec3& p)
+{
+    x.push_back(p.x); y.push_back(p.y); z.push_back(p.z);
+}
+
+/// Gathers the i-th point into a Vec3.
+Vec3 Points3::operator[] (std::size_t i) const
+{
+    return Vec3(x[i], y[i], z[i]);
+}
+
+/// Number of visible points.
+std::size_t Projected::size() const
+{
+    return index.size();
+}
+
+// ----------------------------------------------
+// Frustum
+
+/**
+ * @brief View-Projection Constructor.
+ *
+ * Extracts the six clipping planes from the rows of `m`. A point is inside the clip volume if `-w <= x, y, z <= w` holds for its clip coordinates, which gives one plane per inequality.
+ *
+ * @param m combined view-projection matrix, e.g. `perspective(...) * lookAt(...)`
+ */
+Frustum::Frustum(const Mat4& m)
+{
+    const Vec4 r0{ m.row(0) }, r1{ m.row(1) }, r2{ m.row(2) }, r3{ m.row(3) };
+    planes = {
+        r3 + r0, // left
+        r3 - r0, // right
+        r3 + r1, // bottom
+        r3 - r1, // top
+        r3 + r2, // near
+        r3 - r2, // far
+    };
+}
+
+/**
+ * @brief Point in Frustum.
+ *
+ * True if the point lies on the inner side of all six planes.
+ */
+bool Frustum::contains(const Vec3& p) const
+{
+    for (const Vec4& P : planes)
+        if (P.x * p.x + P.y * p.y + P.z * p.z + P.w < 0.f) return false;
+    return true;
+}
+
+/**
+ * @brief Box-Frustum Test.
+ *
+ * Conservative test of an axis aligned box given by its corners `lo` and `hi`.
+ * For every plane only the corner furthest on the inner side (the "p-vertex") is tested. If it is outside of one plane, the box is invisible.
+ * Boxes close to the edges of the frustum may be reported as visible, although they are not. Boxes that are (partially) visible are never rejected.
+ */
+bool Frustum::intersects(const Vec3& lo, const Vec3& hi) const
+{
+    for (const Vec4& P : planes)
+    {
+        const Float px{ (P.x >= 0.f) ? hi.x : lo.x };
+        const Float py{ (P.y >= 0.f) ? hi.y : lo.y };
+        const Float pz{ (P.z >= 0.f) ? hi.z : lo.z };
+        if (P.x * px + P.y * py + P.z * pz + P.w < 0.f) return false;
+    }
+    return true;
+}
+
+/// Box-Frustum Test for an AABB3, see [intersects(lo, hi)](@ref intersects).
+bool Frustum::intersects(const AABB3& box) const
+{
+    return intersects(box.lo, box.hi);
+}
+
+// ----------------------------------------------
+// Batch Pipeline
+
+/**
+ * @brief Project and Clip a Point Cloud.
+ *
+ * Transforms every input point with the view-projection matrix, drops the points outside of the clip volume and writes the remaining points in normalized device coordinates to `output`.
+ * The output is compacted and keeps the input order; `output.index` maps each result back to its input point.
+ * The kernel works on the SoA arrays with the 16 matrix entries held in registers and a branch free compaction, so the compiler can vectorize it.
+ * Large inputs are split into chunks that are processed on several threads.
+ * Output buffers are resized, not reallocated, so they can be reused between frames.
+ *
+ * @param viewProjection combined matrix, e.g. `perspective(...) * lookAt(...)`
+ * @param input points in world coordinates
+ * @param [out] output visible points in normalized device coordinates
+ * @return the number of visible points
+ */
+std::size_t vml::project(const Mat4& viewProjection, const Points3& input, Projected& output)
+{
+    const std::size_t n{ input.size() };
+    output.ndc.resize(n);
+    output.index.resize(n);
+
+    const std::size_t chunks{ chunkCount(n, _grain) };
+    std::vector<std::size_t> begins(chunks), kept(chunks);
+
+    parallelFor(n, _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        const Mat4& m{ viewProjection };
+        const Float m00{ m.at(0,0) }, m01{ m.at(0,1) }, m02{ m.at(0,2) }, m03{ m.at(0,3) };
+        const Float m10{ m.at(1,0) }, m11{ m.at(1,1) }, m12{ m.at(1,2) }, m13{ m.at(1,3) };
+        const Float m20{ m.at(2,0) }, m21{ m.at(2,1) }, m22{ m.at(2,2) }, m23{ m.at(2,3) };
+        const Float m30{ m.at(3,0) }, m31{ m.at(3,1) }, m32{ m.at(3,2) }, m33{ m.at(3,3) };
+
+        const Float* X{ input.x.data() };
+        const Float* Y{ input.y.data() };
+        const Float* Z{ input.z.data() };
+        Float* oX{ output.ndc.x.data() };
+        Float* oY{ output.ndc.y.data() };
+        Float* oZ{ output.ndc.z.data() };
+        std::size_t* oI{ output.index.data() };
+
+        // write position, only advances for visible points
+        std::size_t k{ begin };
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            const Float cx{ m00 * X[i] + m01 * Y[i] + m02 * Z[i] + m03 };
+            const Float cy{ m10 * X[i] + m11 * Y[i] + m12 * Z[i] + m13 };
+            const Float cz{ m20 * X[i] + m21 * Y[i] + m22 * Z[i] + m23 };
+            const Float cw{ m30 * X[i] + m31 * Y[i] + m32 * Z[i] + m33 };
+            const bool inside{ static_cast<bool>((cw > 0.f)
+                & (-cw <= cx) & (cx <= cw)
+                & (-cw <= cy) & (cy <= cw)
+                & (-cw <= cz) & (cz <= cw)) };
+            const Float iw{ 1.f / cw };
+            oX[k] = cx * iw;
+            oY[k] = cy * iw;
+            oZ[k] = cz * iw;
+            oI[k] = i;
+            k += inside;
+        }
+        begins[c] = begin;
+        kept[c] = k - begin;
+    });
+
+    _compact(output.ndc.x, begins, kept);
+    _compact(output.ndc.y, begins, kept);
+    _compact(output.ndc.z, begins, kept);
+    return _compact(output.index, begins, kept);
+}
+
+/**
+ * @brief Frustum Culling of Boxes.
+ *
+ * Tests every box `(lo[i], hi[i])` against the frustum and writes the indices of the (possibly) visible boxes to `visible`, in ascending order.
+ * Large inputs are split across threads.
+ *
+ * @param frustum the view frustum
+ * @param lo lower corners of the boxes
+ * @param hi upper corners of the boxes, same size as `lo`
+ * @param [out] visible indices of the boxes that intersect the frustum
+ * @return the number of visible boxes
+ */
+std::size_t vml::cull(const Frustum& frustum, const std::vector<Vec3>& lo, const std::vector<Vec3>& hi, std::vector<std::size_t>& visible)
+{
+    assert(lo.size() == hi.size() && "Culling needs as many lower as upper corners.");
+    const std::size_t n{ lo.size() };
+    visible.resize(n);
+
+    const std::size_t chunks{ chunkCount(n, _grain) };
+    std::vector<std::size_t> begins(chunks), kept(chunks);
+
+    parallelFor(n, _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        std::size_t k{ begin };
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            visible[k] = i;
+            k += frustum.intersects(lo[i], hi[i]);
+        }
+        begins[c] = begin;
+        kept[c] = k - begin;
+    });
+
+    return _compact(visible, begins, kept);
+}
+
+/// Frustum Culling of AABB3 boxes, see [cull(frustum, lo, hi, visible)](@ref cull).
+std::size_t vml::cull(const Frustum& frustum, const std::vector<AABB3>& boxes, std::vector<std::size_t>& visible)
+{
+    const std::size_t n{ boxes.size() };
+    visible.resize(n);
+
+    const std::size_t chunks{ chunkCount(n, _grain) };
+    std::vector<std::size_t> begins(chunks), kept(chunks);
+
+    parallelFor(n, _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        std::size_t k{ begin };
+        for (std::size_t i{begin}; i < end; i++)
+        {
+            visible[k] = i;
+            k += frustum.intersects(boxes[i]);
+        }
+        begins[c] = begin;
+        kept[c] = k - begin;
+    });
+
+    return _compact(visible, begins, kept);
+}
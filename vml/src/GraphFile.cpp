@@ -0,0 +1,133 @@
+#include "vml/GraphFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VML_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace vml;
+
+// ----------------------------------------------
+// Constructors
+
+/// Closed file.
+MappedFile::MappedFile() : begin{ nullptr }, length{ 0 }, mapped{ false }
+{}
+
+/// Takes over the mapping of `other`, which is closed afterwards.
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    begin{ other.begin }, length{ other.length }, mapped{ other.mapped }, buffer{ std::move(other.buffer) }
+{
+    other.begin = nullptr;
+    other.length = 0;
+    other.mapped = false;
+}
+
+/// Closes this file and takes over the mapping of `other`.
+MappedFile& MappedFile::operator = (MappedFile&& other) noexcept
+{
+    if (this == &other) return *this;
+    close();
+    begin = other.begin;
+    length = other.length;
+    mapped = other.mapped;
+    buffer = std::move(other.buffer);
+    other.begin = nullptr;
+    other.length = 0;
+    other.mapped = false;
+    return *this;
+}
+
+/// Unmaps the file.
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+// ----------------------------------------------
+// Methods
+
+/**
+ * @brief Opens a File.
+ *
+ * Maps the whole file read only. An open file is closed first.
+ *
+ * @return `false` if the file can not be opened, is empty or can not be mapped
+ */
+bool MappedFile::open(const std::string& path)
+{
+    close();
+#ifdef VML_MMAP
+    const int fd{ ::open(path.c_str(), O_RDONLY) };
+    if (fd < 0) return false;
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    length = static_cast<std::size_t>(info.st_size);
+    void* address{ (length > 0) ? ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED };
+    // the mapping stays valid after closing the descriptor
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+        length = 0;
+        return false;
+    }
+    begin = static_cast<const char*>(address);
+    mapped = true;
+    return true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    length = static_cast<std::size_t>(file.tellg());
+    if (length == 0) return false;
+    buffer.resize((length + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t) + 1);
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(length)))
+    {
+        close();
+        return false;
+    }
+    begin = reinterpret_cast<const char*>(buffer.data());
+    return true;
+#endif
+}
+
+/// Unmaps the file or frees the buffer.
+void MappedFile::close()
+{
+#ifdef VML_MMAP
+    if (mapped) ::munmap(const_cast<char*>(begin), length);
+#endif
+    begin = nullptr;
+    length = 0;
+    mapped = false;
+    buffer.clear();
+    buffer.shrink_to_fit();
+}
+
+// ----------------------------------------------
+// Properties
+
+/// Is a file open?
+bool MappedFile::isOpen() const
+{
+    return begin != nullptr;
+}
+
+/// Start of the file contents, `nullptr` if no file is open.
+const char* MappedFile::data() const
+{
+    return begin;
+}
+
+/// Size of the file in bytes.
+std::size_t MappedFile::size() const
+{
+    return length;
+}
@@ -0,0 +1,294 @@
+#include "vml/Intersection.h"
+#include "vml/parallel.h"
+
+#include <algorithm> // std::sort
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+namespace {
+
+/// minimal number of shapes per thread in the batch overlap test
+const std::size_t _grain{ 256 };
+
+/// z-component of the cross product
+inline Float _cross(const Vec2& u, const Vec2& v)
+{
+    return u.x * v.y - u.y * v.x;
+}
+
+/// Does the curved arc `a` pass through the point `p` of its circle?
+inline bool _passes(const Arc& a, const Vec2& c, const Vec2& p)
+{
+    return a.reaches(std::atan2(p.y - c.y, p.x - c.x));
+}
+
+/**
+ * @brief Segment vs Segment.
+ *
+ * Intersects the segments `p + s*u` (0 <= s <= lu) and `q + r*v` (0 <= r <= lv), `u` and `v` are unit vectors.
+ * Overlapping collinear segments report the end points of the common part.
+ */
+int _segmentSegment(const Vec2& p, const Vec2& u, Float lu, const Vec2& q, const Vec2& v, Float lv, Vec2 points[2])
+{
+    const Vec2 w{ q - p };
+    const Float denom{ _cross(u, v) };
+    if (denom == 0.f)
+    {
+        // parallel, only collinear segments can touch
+        if (_cross(w, u) != 0.f) return 0;
+        const Float s0{ dot(w, u) };
+        const Float s1{ s0 + lv * dot(v, u) };
+        const Float lo{ std::max(std::min(s0, s1), 0.f) };
+        const Float hi{ std::min(std::max(s0, s1), lu) };
+        if (lo > hi) return 0;
+        points[0] = p + lo * u;
+        if (lo == hi) return 1;
+        points[1] = p + hi * u;
+        return 2;
+    }
+    const Float s{ _cross(w, v) / denom };
+    const Float r{ _cross(w, u) / denom };
+    if (s < 0.f || s > lu || r < 0.f || r > lv) return 0;
+    points[0] = p + s * u;
+    return 1;
+}
+
+/**
+ * @brief Segment vs Arc.
+ *
+ * Intersects the segment `p + s*u` (0 <= s <= lu, `u` unit vector) with an arc, the arc may be straight as well.
+ * For curved arcs the line is intersected with the circle and the points are kept, that lie on the segment and are [reached](@ref Arc::reaches) by the arc.
+ */
+int _segmentArc(const Vec2& p, const Vec2& u, Float lu, const Arc& b, Vec2 points[2])
+{
+    if (b.isStraight()) return _segmentSegment(p, u, lu, b.srt, polar(b.ang), b.lng, points);
+
+    const Vec2 c{ b.center() };
+    const Float r{ b.radius() };
+    const Vec2 f{ p - c };
+    const Float half{ dot(f, u) };
+    const Float disc{ half*half - (dot(f, f) - r*r) };
+    if (disc < 0.f) return 0;
+    const Float root{ std::sqrt(disc) };
+    int n{ 0 };
+    for (const Float s : { -half - root, -half + root })
+    {
+        if (s < 0.f || s > lu) continue;
+        const Vec2 x{ p + s * u };
+        if (_passes(b, c, x)) points[n++] = x;
+        // tangent lines touch only once
+        if (root == 0.f) break;
+    }
+    return n;
+}
+
+/**
+ * @brief Broad Phase Entry.
+ *
+ * Bounding box of one arc together with its position in the shape, sorted by `box.lo.x` for the sweep.
+ */
+struct _Entry
+{
+    AABB2 box;
+    std::size_t arc;
+};
+
+/// Collects the boxes of all arcs of `shape` that touch `region`, sorted along x.
+void _entries(const ArcShape& shape, const AABB2& region, std::vector<_Entry>& entries)
+{
+    entries.clear();
+    for (std::size_t i{0}; i < shape.size(); i++)
+    {
+        const AABB2 box{ shape[i].bounds() };
+        if (box.intersects(region)) entries.push_back(_Entry{ box, i });
+    }
+    std::sort(entries.begin(), entries.end(), [](const _Entry& a, const _Entry& b) { return a.box.lo.x < b.box.lo.x; });
+}
+
+/**
+ * @brief Prepared Shape.
+ *
+ * The bounds of a shape and the boxes of all of its arcs, sorted along x.
+ * A batch test prepares its fixed shape once, instead of recomputing the boxes of its arcs for every pair.
+ */
+struct _Prepared
+{
+    const ArcShape& shape;
+    AABB2 bounds;
+    std::vector<_Entry> entries;
+
+    _Prepared(const ArcShape& _shape) : shape(_shape)
+    {
+        for (std::size_t i{0}; i < shape.size(); i++) entries.push_back(_Entry{ shape[i].bounds(), i });
+        for (const _Entry& e : entries) bounds.extend(e.box);
+        std::sort(entries.begin(), entries.end(), [](const _Entry& a, const _Entry& b) { return a.box.lo.x < b.box.lo.x; });
+    }
+};
+
+/**
+ * @brief Overlap Test with Scratch Memory.
+ *
+ * Implementation of [overlaps](@ref overlaps) for a prepared shape `a`. The broad phase lists are passed in, so that batch tests can reuse their memory.
+ */
+bool _overlaps(const _Prepared& pa, const ArcShape& b, std::vector<_Entry>& ea, std::vector<_Entry>& eb)
+{
+    const ArcShape& a{ pa.shape };
+    if (a.empty() || b.empty()) return false;
+    const AABB2& boxA{ pa.bounds };
+    const AABB2 boxB{ b.bounds() };
+    if (!boxA.intersects(boxB)) return false;
+
+    // broad phase: only arcs inside the common region, sweep and prune along x
+    const AABB2 region{ intersection(boxA, boxB) };
+    ea.clear();
+    // the prepared entries are sorted already, filtering keeps the order
+    for (const _Entry& e : pa.entries)
+        if (e.box.intersects(region)) ea.push_back(e);
+    _entries(b, region, eb);
+
+    Vec2 points[2];
+    std::size_t i{ 0 }, j{ 0 };
+    while (i < ea.size() && j < eb.size())
+    {
+        if (ea[i].box.lo.x <= eb[j].box.lo.x)
+        {
+            for (std::size_t k{j}; k < eb.size() && eb[k].box.lo.x <= ea[i].box.hi.x; k++)
+                if (ea[i].box.intersects(eb[k].box) && intersect(a[ea[i].arc], b[eb[k].arc], points) > 0) return true;
+            i++;
+        }
+        else
+        {
+            for (std::size_t k{i}; k < ea.size() && ea[k].box.lo.x <= eb[j].box.hi.x; k++)
+                if (eb[j].box.intersects(ea[k].box) && intersect(a[ea[k].arc], b[eb[j].arc], points) > 0) return true;
+            j++;
+        }
+    }
+
+    // the boundaries do not cross, so either one shape lies inside the other or they are disjoint
+    if (boxB.contains(a.front().srt) && b.contains(a.front().srt)) return true;
+    if (boxA.contains(b.front().srt) && a.contains(b.front().srt)) return true;
+    return false;
+}
+
+} /* anonymous */
+
+// ----------------------------------------------
+// Exact Intersection Kernels
+
+/**
+ * @brief Arc vs Arc.
+ *
+ * Computes the intersection points of two arcs analytically, without discretizing them.
+ * Two curved arcs are intersected via their circles, straight arcs are handled as segments.
+ * Arcs on the same circle (or on the same line) report the end points of their common part.
+ *
+ * @param [out] points receives up to two intersection points
+ * @return number of intersection points
+ */
+int vml::intersect(const Arc& a, const Arc& b, Vec2 points[2])
+{
+    if (a.isStraight()) return _segmentArc(a.srt, polar(a.ang), a.lng, b, points);
+    if (b.isStraight()) return _segmentArc(b.srt, polar(b.ang), b.lng, a, points);
+
+    const Vec2 ca{ a.center() };
+    const Vec2 cb{ b.center() };
+    const Float ra{ a.radius() };
+    const Float rb{ b.radius() };
+    const Vec2 w{ cb - ca };
+    const Float d{ w.norm() };
+
+    if (d == 0.f)
+    {
+        // concentric circles only touch if they are the same circle
+        if (ra != rb) return 0;
+        int n{ 0 };
+        for (const Vec2& p : { b.srt, b.end() })
+            if (n < 2 && _passes(a, ca, p)) points[n++] = p;
+        for (const Vec2& p : { a.srt, a.end() })
+            if (n < 2 && _passes(b, cb, p)) points[n++] = p;
+        return n;
+    }
+    if (d > ra + rb || d < abs(ra - rb)) return 0;
+
+    // distance of the chord from ca along w and half of the chord length
+    const Float l{ (ra*ra - rb*rb + d*d) / (2.f * d) };
+    const Float h{ std::sqrt(std::max(ra*ra - l*l, 0.f)) };
+    const Vec2 e{ w / d };
+    const Vec2 m{ ca + l * e };
+    const Vec2 n{ -e.y, e.x };
+
+    int count{ 0 };
+    for (const Vec2& p : { m + h * n, m - h * n })
+    {
+        if (_passes(a, ca, p) && _passes(b, cb, p)) points[count++] = p;
+        // touching circles have only one common point
+        if (h == 0.f) break;
+    }
+    return count;
+}
+
+/**
+ * @brief Arc vs Segment.
+ *
+ * Computes the intersection points of an arc and the segment from `p` to `q` analytically.
+ *
+ * @param [out] points receives up to two intersection points
+ * @return number of intersection points
+ */
+int vml::intersect(const Arc& a, const Vec2& p, const Vec2& q, Vec2 points[2])
+{
+    const Float length{ distance(p, q) };
+    if (length == 0.f)
+    {
+        // degenerated segment: test the single point
+        const Vec2 x{ a.closestPoint(p) };
+        if (x.x != p.x || x.y != p.y) return 0;
+        points[0] = p;
+        return 1;
+    }
+    return _segmentArc(p, (q - p) / length, length, a, points);
+}
+
+// ----------------------------------------------
+// Shape Overlap
+
+/**
+ * @brief Do two shapes overlap?
+ *
+ * Two closed shapes overlap if their boundaries intersect or if one lies inside the other.
+ * The test runs without discretization: the shape bounds reject distant pairs, a sweep over the bounds of the arcs in the common region selects the candidate pairs and the [exact kernels](@ref intersect) decide.
+ * Only if no boundaries cross, a single [containment test](@ref ArcShape::contains) per shape is needed.
+ */
+bool vml::overlaps(const ArcShape& a, const ArcShape& b)
+{
+    std::vector<_Entry> ea, eb;
+    return _overlaps(_Prepared(a), b, ea, eb);
+}
+
+/**
+ * @brief Batch Overlap Test.
+ *
+ * Tests `shape` against all `others` in parallel and writes the indices of the overlapping ones into `hits` (in ascending order).
+ * The bounds and the sorted arc boxes of `shape` are computed once for all tests, and every thread reuses its broad phase memory.
+ *
+ * @param [out] hits indices of the overlapping shapes, resized to their number
+ * @return number of overlapping shapes
+ */
+std::size_t vml::overlaps(const ArcShape& shape, const std::vector<ArcShape>& others, std::vector<std::size_t>& hits)
+{
+    const _Prepared prepared(shape);
+    std::vector<std::vector<std::size_t>> partial(chunkCount(others.size(), _grain));
+    parallelFor(others.size(), _grain, [&](std::size_t c, std::size_t begin, std::size_t end)
+    {
+        std::vector<_Entry> ea, eb;
+        for (std::size_t i{begin}; i < end; i++)
+            if (_overlaps(prepared, others[i], ea, eb)) partial[c].push_back(i);
+    });
+
+    hits.clear();
+    for (const std::vector<std::size_t>& p : partial) hits.insert(hits.end(), p.begin(), p.end());
+    return hits.size();
+}
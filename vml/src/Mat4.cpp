@@ -2,6 +2,15 @@
 
 using namespace vml;
 
+// ----------------------------------------------
+// Lokale Funktionen
+
+/// Die generische Matrix einer Mat4, ihre Operatoren rufen nicht die Mat4-Operatoren auf.
+inline const Mat<Float, 4, 4>& _mat(const Mat4& m)
+{
+    return m;
+}
+
 // ----------------------------------------------
 // Konstruktoren
 
@@ -17,26 +26,25 @@ using namespace vml;
  *  `
  */
 Mat4::Mat4(const Vec4& ex, const Vec4& ey, const Vec4& ez, const Vec4& ew) :
-M{
-    ex.x, ex.y, ex.z, ex.w,
-    ey.x, ey.y, ey.z, ey.w,
-    ez.x, ez.y, ez.z, ez.w,
-    ew.x, ew.y, ew.z, ew.w,
-}{}
+Mat<Float, 4, 4>(ex, ey, ez, ew)
+{}
+
+/**
+ * @brief Konvertierung.
+ *
+ * Übernimmt die Einträge einer generischen 4x4 Matrix, z.B. das Ergebnis von `transposed()`.
+ */
+Mat4::Mat4(const Mat<Float, 4, 4>& m) : Mat<Float, 4, 4>(m)
+{}
 
 /**
  * @brief Diagonal Konstruktor.
  *
- * Erzeugt vier Spaltenvektoren, sodass der Parameter `d` auf der Hauptdiagonalen zu finden ist und alle andern Werte auf 0 gesetzt werden.
- * Damit wird der Vektor Konstruktor aufgerufen.
+ * Der Parameter `d` steht auf der Hauptdiagonalen, alle andern Werte werden auf 0 gesetzt.
  *
  * @param d der Wert auf der Hauptdiagonalen.
  */
-Mat4::Mat4(Float d) :
-Mat4(Vec4(d, 0, 0, 0),
-     Vec4(0, d, 0, 0),
-     Vec4(0, 0, d, 0),
-     Vec4(0, 0, 0, d))
+Mat4::Mat4(Float d) : Mat<Float, 4, 4>(d)
 {}
 
 /**
@@ -58,84 +66,53 @@ Mat4::Mat4() : Mat4(1.f)
  */
 Float* Mat4::data()
 {
-    return &M[0];
+    return Mat<Float, 4, 4>::data;
 }
 
-///@{
 /**
- * @brief Indizierung.
+ * @brief Zeilen Zugang.
  *
- * Übergibt den Index an den internen Datenspeicher `M`, wodurch alle 16 Einträge direkt zugänglich sind.
+ * Erstellt einen Vec4 auf den Einträgen in der Zeile und gibt diesen zurück. Die Referenz zu den Daten geht dabei verloren
  */
-Float& Mat4::operator[] (int i)
-{
-    return M[i];
-}
-const Float& Mat4::operator[] (int i) const
+Vec4 Mat4::row(int i) const
 {
-    return M[i];
+    return Vec4(Mat<Float, 4, 4>::row(i));
 }
-///@}
 
-///@{
 /**
- * @brief Zeile- und Spaltenzugang.
- *
- * Berechnet den korrekten Index im internen Datenspeicher. Und gibt den wert an der Richtigen Stelle zurück.
+ * @brief Spalten Zugang.
  *
- * @param row Index der Zeile
- * @param col Index der Spalte
+ * Erstellt einen Vec4 auf den Einträgen in der Spalten und gibt diesen zurück. Die Referenz zu den Daten geht dabei verloren
  */
-Float& Mat4::at(int row, int col)
-{
-    return M[row * vSize + col];
-}
-Float Mat4::at(int row, int col) const
+Vec4 Mat4::col(int i) const
 {
-    return M[col * vSize + row];
+    return Vec4(Mat<Float, 4, 4>::col(i));
 }
-///@}
+
+// ----------------------------------------------
+// Operators
 
 /**
- * @brief Zeilen Zugang.
+ * @brief Matrixmultiplikation.
  *
- * Erstellt einen Vec4 auf den Einträgen in der Zeile und gibt diesen zurück. Die Referenz zu den Daten geht dabei verloren
+ * Das Produkt `a * b` beschreibt die Transformation `b` gefolgt von `a`, z.B. `projection * view`.
  */
-Vec4 Mat4::row(int i) const
+Mat4 vml::operator * (const Mat4& a, const Mat4& b)
 {
-    return Vec4(at(i,0), at(i,0), at(i,0), at(i,0));
+    return Mat4(_mat(a) * _mat(b));
 }
 
 /**
- * @brief Spalten Zugang.
+ * @brief Matrix-Vektor-Produkt.
  *
- * Erstellt einen Vec4 auf den Einträgen in der Spalten und gibt diesen zurück. Die Referenz zu den Daten geht dabei verloren
+ * Transformiert den Spaltenvektor `v` mit der Matrix `m`.
  */
-Vec4 Mat4::col(int i) const
+Vec4 vml::operator * (const Mat4& m, const Vec4& v)
 {
-    return Vec4(at(0,i), at(1,i), at(2,i), at(3,i));
+    const Vec<Float, 4>& u{ v };
+    return Vec4(_mat(m) * u);
 }
 
-// ----------------------------------------------
-// Methods
-
-//Mat4 Mat4::transposed() const
-//{
-//    Vec4 ex{ Vec4(at(0, 0), at(1, 0), at(2, 0), at(3, 0)) };
-//    Vec4 ey{ Vec4(at(0, 1), at(1, 1), at(2, 1), at(3, 1))  };
-//    Vec4 ez{ Vec4(at(0, 2), at(1, 2), at(2, 2), at(3, 2)) };
-//    Vec4 ew{ Vec4(at(0, 3), at(1, 3), at(2, 3), at(3, 3)) };
-//    return Mat4(ex, ey, ez, ew);
-//}
-
-//Float Mat4::det() const
-//{
-//
-//}
-
-// ----------------------------------------------
-// Operators
-
 std::ostream& vml::operator << (std::ostream& os, const Mat4& m)
 {
     return os << parse::toString(m);
@@ -150,6 +127,7 @@ std::ostream& vml::operator << (std::ostream& os, const Mat4& m)
  *
  * Implementierung von https://stackoverflow.com/a/6802424/5416171.
  * creates a viewing matrix derived from an eye point, a reference point indicating the center of the scene, and an UP vector.
+ * Die Zeilen sind die Kameraachsen (rechts, oben, hinten), die letzte Spalte verschiebt das Auge in den Ursprung. Die Kamera schaut wie in OpenGL in Richtung der negativen z-Achse.
  *
  * @param eye Specifies the position of the eye (camera) point
  * @param center Specifies the position of the reference point
@@ -158,12 +136,12 @@ std::ostream& vml::operator << (std::ostream& os, const Mat4& m)
 Mat4 vml::lookAt(const Vec3& from, const Vec3& to, const Vec3& up = Vec3(0, 1, 0))
 {
     Vec3 f{ (from-to).normalized() };
-    Vec3 s{ cross(f,up).normalized() };
-    Vec3 u{ cross(s,f).normalized() };
+    Vec3 s{ cross(up,f).normalized() };
+    Vec3 u{ cross(f,s).normalized() };
     
-    Vec4 ex {s.x, u.x, f.x, 0};
-    Vec4 ey {s.y, u.y, f.y, 0};
-    Vec4 ez {s.z, u.z, f.z, 0};
+    Vec4 ex {s.x, s.y, s.z, -dot(s, from)};
+    Vec4 ey {u.x, u.y, u.z, -dot(u, from)};
+    Vec4 ez {f.x, f.y, f.z, -dot(f, from)};
     Vec4 ew {  0,   0,   0, 1};
     return Mat4(ex, ey, ez, ew);
 }
@@ -191,6 +169,28 @@ Mat4 vml::ortho(Float left, Float right, Float bottom, Float top, Float near, Fl
     };
 }
 
+/**
+ * @brief Perspektivische Projektionsmatrix.
+ *
+ * Implementierung von https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml
+ * Beschreibt eine Zentralprojektion mit symmetrischem Sichtkegel (Frustum). Nach der Division durch w liegen sichtbare Punkte im Würfel [-1, 1]^3.
+ *
+ * @param fovy vertikaler Öffnungswinkel in Radiant
+ * @param aspect Seitenverhältnis (Breite / Höhe)
+ * @param near Abstand zur nahen Clipping-Ebene, muss positiv sein
+ * @param far Abstand zur fernen Clipping-Ebene
+ */
+Mat4 vml::perspective(Float fovy, Float aspect, Float near, Float far)
+{
+    const Float f{ 1.f / std::tan(.5f * fovy) };
+    return {
+        Vec4{ f/aspect, 0, 0, 0 },
+        Vec4{ 0, f, 0, 0 },
+        Vec4{ 0, 0, (far+near)/(near-far), 2.f*far*near/(near-far) },
+        Vec4{ 0, 0, -1, 0 }
+    };
+}
+
 // ----------------------------------------------
 // Debugging
 
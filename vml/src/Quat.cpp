@@ -0,0 +1,514 @@
+#include "vml/Quat.h"
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/**
+ * @brief Slerp Weights.
+ *
+ * Calculates the weights of the two quaternions for a spherical interpolation given their dot product `d`.
+ * The second weight carries the sign flip, so that the interpolation always takes the shorter arc.
+ * Almost parallel quaternions fall back to linear weights, because `sin(theta)` vanishes.
+ */
+inline void _slerpWeights(Float d, Float t, Float& a, Float& b)
+{
+    const Float flip{ (d < 0.f) ? -1.f : 1.f };
+    d *= flip;
+    if (d > .9995f)
+    {
+        a = 1.f - t;
+        b = flip * t;
+        return;
+    }
+    const Float theta{ std::acos(d) };
+    const Float inv{ 1.f / std::sin(theta) };
+    a = std::sin((1.f - t) * theta) * inv;
+    b = flip * std::sin(t * theta) * inv;
+}
+
+// ----------------------------------------------
+// Constructors
+
+/**
+ * @brief Standard Constructor.
+ *
+ * Initializes the four components explicitly via parameter input. The order of the parameter corresponds to x, y, z, w.
+ */
+Quat::Quat(Float _x, Float _y, Float _z, Float _w) :
+x(_x), y(_y), z(_z), w(_w)
+{}
+
+/**
+ * @brief Axis-Angle Constructor.
+ *
+ * Creates the unit quaternion that rotates by `angle` (radians) around `axis`. The axis is normalized internally.
+ *
+ * @param axis rotation axis, does not need to be of unit length
+ * @param angle angle of rotation in radians (right hand rule)
+ */
+Quat::Quat(const Vec3& axis, Float angle)
+{
+    const Vec3 n{ axis.normalized() };
+    const Float s{ std::sin(.5f * angle) };
+    x = n.x * s; y = n.y * s; z = n.z * s;
+    w = std::cos(.5f * angle);
+}
+
+/**
+ * @brief Vec4 Constructor.
+ *
+ * Reinterprets the coordinates of a Vec4 as quaternion components, i.e. `Vec4(x, y, z, w)`.
+ */
+Quat::Quat(const Vec4& v) : Quat(v.x, v.y, v.z, v.w)
+{}
+
+/**
+ * @brief Identity (Default Constructor).
+ *
+ * Initializes the quaternion to `(0, 0, 0, 1)`, which is a rotation by zero radians.
+ */
+Quat::Quat() : Quat(0.f, 0.f, 0.f, 1.f)
+{}
+
+// ----------------------------------------------
+// Operators
+
+/**
+ * @brief Inversion.
+ *
+ * Toggles the sign of all components. Note that `-q` describes the same rotation as `q`.
+ */
+Quat Quat::operator -() const
+{
+    return Quat(-x, -y, -z, -w);
+}
+
+/**
+ * @brief Assignment Operators.
+ *
+ * Component wise addition and subtraction, the Hamilton product and scalar scaling.
+ */
+///@{
+void Quat::operator += (const Quat& other)
+{
+    x += other.x; y += other.y; z += other.z; w += other.w;
+}
+void Quat::operator -= (const Quat& other)
+{
+    x -= other.x; y -= other.y; z -= other.z; w -= other.w;
+}
+void Quat::operator *= (const Quat& other)
+{
+    *this = (*this) * other;
+}
+void Quat::operator *= (Float factor)
+{
+    x *= factor; y *= factor; z *= factor; w *= factor;
+}
+///@}
+
+// ----------------------------------------------
+// (Other) Methods
+
+/**
+ * @brief Quaternion Length.
+ *
+ * The Euclidian norm of the four components. Rotation quaternions have a norm of 1.
+ */
+Float Quat::norm() const
+{
+    return std::sqrt(x*x + y*y + z*z + w*w);
+}
+
+/**
+ * @brief Unit Quaternion.
+ *
+ * Returns the quaternion scaled to a norm of 1. Repeated products accumulate rounding errors, so they should be normalized every now and then.
+ */
+Quat Quat::normalized() const
+{
+    Float l{ 1.f / norm() };
+    return Quat(x*l, y*l, z*l, w*l);
+}
+
+/**
+ * @brief Conjugate.
+ *
+ * Negates the vector part. For unit quaternions the conjugate is the inverse rotation.
+ */
+Quat Quat::conjugated() const
+{
+    return Quat(-x, -y, -z, w);
+}
+
+/**
+ * @brief Inverse.
+ *
+ * The multiplicative inverse `q* / |q|^2`, which also works for quaternions that are not normalized.
+ */
+Quat Quat::inverse() const
+{
+    Float l{ 1.f / (x*x + y*y + z*z + w*w) };
+    return Quat(-x*l, -y*l, -z*l, w*l);
+}
+
+/**
+ * @brief Rotation Angle.
+ *
+ * The angle in radians, the unit quaternion rotates around its [axis](@ref axis). The result lies in [0, 2pi].
+ */
+Float Quat::angle() const
+{
+    return 2.f * std::acos(std::fmin(std::fmax(w, -1.f), 1.f));
+}
+
+/**
+ * @brief Rotation Axis.
+ *
+ * The normalized vector part of the quaternion. For the identity rotation, which has no defined axis, the x-axis is returned.
+ */
+Vec3 Quat::axis() const
+{
+    const Float s{ std::sqrt(x*x + y*y + z*z) };
+    if (s == 0.f) return Vec3(1.f, 0.f, 0.f);
+    return Vec3(x/s, y/s, z/s);
+}
+
+/**
+ * @brief Rotate a Vector.
+ *
+ * Applies the rotation of this unit quaternion to `v`.
+ * Instead of the sandwich product `q * v * q*` the equivalent form `v + w*t + u x t` with `t = 2 * u x v` is used, which needs only two cross products.
+ *
+ * @param v the vector to be rotated
+ */
+Vec3 Quat::rotate(const Vec3& v) const
+{
+    const Vec3 u{ x, y, z };
+    const Vec3 t{ 2.f * cross(u, v) };
+    return v + w * t + cross(u, t);
+}
+
+/**
+ * @brief Conversion to Vec4.
+ *
+ * Returns the four components as a Vec4 in the order x, y, z, w.
+ */
+Vec4 Quat::vec4() const
+{
+    return Vec4(x, y, z, w);
+}
+
+/**
+ * @brief Conversion to Mat4.
+ *
+ * Creates the rotation matrix of this unit quaternion. The translation part is zero and the last row is `(0, 0, 0, 1)`.
+ */
+Mat4 Quat::mat4() const
+{
+    const Float xx{ x*x }, yy{ y*y }, zz{ z*z };
+    const Float xy{ x*y }, xz{ x*z }, yz{ y*z };
+    const Float wx{ w*x }, wy{ w*y }, wz{ w*z };
+    return {
+        Vec4{ 1.f - 2.f*(yy + zz), 2.f*(xy - wz), 2.f*(xz + wy), 0.f },
+        Vec4{ 2.f*(xy + wz), 1.f - 2.f*(xx + zz), 2.f*(yz - wx), 0.f },
+        Vec4{ 2.f*(xz - wy), 2.f*(yz + wx), 1.f - 2.f*(xx + yy), 0.f },
+        Vec4{ 0.f, 0.f, 0.f, 1.f }
+    };
+}
+
+// ----------------------------------------------
+// Namespace Methods
+
+/**
+ * @brief Quaternion Operators.
+ *
+ * Component wise addition and subtraction, scalar scaling and the (non commutative) Hamilton product.
+ * The product `p * q` describes the rotation `q` followed by the rotation `p`.
+ */
+///@{
+Quat vml::operator + (const Quat& p, const Quat& q)
+{
+    return Quat(p.x + q.x, p.y + q.y, p.z + q.z, p.w + q.w);
+}
+Quat vml::operator - (const Quat& p, const Quat& q)
+{
+    return Quat(p.x - q.x, p.y - q.y, p.z - q.z, p.w - q.w);
+}
+Quat vml::operator * (const Quat& p, const Quat& q)
+{
+    return Quat(p.w*q.x + p.x*q.w + p.y*q.z - p.z*q.y,
+                p.w*q.y - p.x*q.z + p.y*q.w + p.z*q.x,
+                p.w*q.z + p.x*q.y - p.y*q.x + p.z*q.w,
+                p.w*q.w - p.x*q.x - p.y*q.y - p.z*q.z);
+}
+Quat vml::operator * (Float factor, const Quat& q)
+{
+    return Quat(factor * q.x, factor * q.y, factor * q.z, factor * q.w);
+}
+Quat vml::operator * (const Quat& q, Float factor)
+{
+    return Quat(factor * q.x, factor * q.y, factor * q.z, factor * q.w);
+}
+///@}
+
+/**
+ * @brief Dot Product.
+ *
+ * The four dimensional dot product. For unit quaternions it is the cosine of half the angle between the two rotations.
+ */
+Float vml::dot(const Quat& p, const Quat& q)
+{
+    return p.x * q.x + p.y * q.y + p.z * q.z + p.w * q.w;
+}
+
+/**
+ * @brief Quaternion from Rotation Matrix.
+ *
+ * Extracts the rotation of the upper left 3x3 block of `m` (Shepperd's method).
+ * The largest of the four diagonal combinations is used as divisor to stay numerically stable.
+ *
+ * @param m a matrix whose upper left 3x3 block is a rotation
+ */
+Quat vml::quat(const Mat4& m)
+{
+    const Float m00{ m.at(0,0) }, m11{ m.at(1,1) }, m22{ m.at(2,2) };
+    const Float trace{ m00 + m11 + m22 };
+    if (trace > 0.f)
+    {
+        const Float s{ 2.f * std::sqrt(trace + 1.f) };
+        return Quat((m.at(2,1) - m.at(1,2)) / s,
+                    (m.at(0,2) - m.at(2,0)) / s,
+                    (m.at(1,0) - m.at(0,1)) / s,
+                    .25f * s);
+    }
+    if (m00 > m11 && m00 > m22)
+    {
+        const Float s{ 2.f * std::sqrt(1.f + m00 - m11 - m22) };
+        return Quat(.25f * s,
+                    (m.at(0,1) + m.at(1,0)) / s,
+                    (m.at(0,2) + m.at(2,0)) / s,
+                    (m.at(2,1) - m.at(1,2)) / s);
+    }
+    if (m11 > m22)
+    {
+        const Float s{ 2.f * std::sqrt(1.f + m11 - m00 - m22) };
+        return Quat((m.at(0,1) + m.at(1,0)) / s,
+                    .25f * s,
+                    (m.at(1,2) + m.at(2,1)) / s,
+                    (m.at(0,2) - m.at(2,0)) / s);
+    }
+    const Float s{ 2.f * std::sqrt(1.f + m22 - m00 - m11) };
+    return Quat((m.at(0,2) + m.at(2,0)) / s,
+                (m.at(1,2) + m.at(2,1)) / s,
+                .25f * s,
+                (m.at(1,0) - m.at(0,1)) / s);
+}
+
+/**
+ * @brief Normalized Linear Interpolation.
+ *
+ * Interpolates linearly between `p` and `q` and normalizes the result.
+ * Cheaper than [slerp](@ref slerp), but the angular velocity is not constant. Takes the shorter arc.
+ *
+ * @param t interpolation parameter between 0 (`p`) and 1 (`q`)
+ */
+Quat vml::nlerp(const Quat& p, const Quat& q, Float t)
+{
+    const Float b{ (dot(p, q) < 0.f) ? -t : t };
+    return ((1.f - t) * p + b * q).normalized();
+}
+
+/**
+ * @brief Spherical Linear Interpolation.
+ *
+ * Interpolates between two unit quaternions with constant angular velocity along the shorter arc.
+ *
+ * @param t interpolation parameter between 0 (`p`) and 1 (`q`)
+ */
+Quat vml::slerp(const Quat& p, const Quat& q, Float t)
+{
+    Float a, b;
+    _slerpWeights(dot(p, q), t, a, b);
+    return (a * p + b * q).normalized();
+}
+
+/**
+ * @brief Batch Rotation.
+ *
+ * Rotates every vector of `input` by the same quaternion. The output is resized to the input size, so a buffer can be reused between calls without reallocation.
+ */
+void vml::rotate(const Quat& q, const std::vector<Vec3>& input, std::vector<Vec3>& output)
+{
+    output.resize(input.size());
+    for (std::size_t i{0}; i < input.size(); i++)
+        output[i] = q.rotate(input[i]);
+}
+
+/**
+ * @brief Batch Slerp.
+ *
+ * Interpolates the two arrays element wise, e.g. two poses of a skeleton. `from` and `to` need to have the same size.
+ * The output is resized to the input size, so a buffer can be reused between calls without reallocation.
+ *
+ * @param t either one parameter for all elements or one parameter per element
+ */
+///@{
+void vml::slerp(const std::vector<Quat>& from, const std::vector<Quat>& to, Float t, std::vector<Quat>& output)
+{
+    assert(from.size() == to.size() && "Batch slerp needs arrays of same size.");
+    output.resize(from.size());
+    for (std::size_t i{0}; i < from.size(); i++)
+    {
+        Float a, b;
+        _slerpWeights(dot(from[i], to[i]), t, a, b);
+        output[i] = (a * from[i] + b * to[i]).normalized();
+    }
+}
+void vml::slerp(const std::vector<Quat>& from, const std::vector<Quat>& to, const std::vector<Float>& t, std::vector<Quat>& output)
+{
+    assert(from.size() == to.size() && from.size() == t.size() && "Batch slerp needs arrays of same size.");
+    output.resize(from.size());
+    for (std::size_t i{0}; i < from.size(); i++)
+    {
+        Float a, b;
+        _slerpWeights(dot(from[i], to[i]), t[i], a, b);
+        output[i] = (a * from[i] + b * to[i]).normalized();
+    }
+}
+///@}
+
+// ----------------------------------------------
+// Dual Quaternion
+
+/**
+ * @brief Standard Constructor.
+ *
+ * Initializes the real and the dual part explicitly.
+ */
+DualQuat::DualQuat(const Quat& _real, const Quat& _dual) :
+real(_real), dual(_dual)
+{}
+
+/**
+ * @brief Rotation-Translation Constructor.
+ *
+ * Creates the rigid transformation, that first rotates by the unit quaternion `rot` and then translates by `off`.
+ */
+DualQuat::DualQuat(const Quat& rot, const Vec3& off) :
+DualQuat(rot, .5f * Quat(off.x, off.y, off.z, 0.f) * rot)
+{}
+
+/**
+ * @brief Identity (Default Constructor).
+ *
+ * No rotation and no translation.
+ */
+DualQuat::DualQuat() : DualQuat(Quat(), Quat(0.f, 0.f, 0.f, 0.f))
+{}
+
+/**
+ * @brief Unit Dual Quaternion.
+ *
+ * Scales both parts by the inverse norm of the real part.
+ */
+DualQuat DualQuat::normalized() const
+{
+    Float l{ 1.f / real.norm() };
+    return DualQuat(l * real, l * dual);
+}
+
+/**
+ * @brief Conjugate.
+ *
+ * Conjugates both parts. For unit dual quaternions this is the inverse transformation.
+ */
+DualQuat DualQuat::conjugated() const
+{
+    return DualQuat(real.conjugated(), dual.conjugated());
+}
+
+/**
+ * @brief Translation Part.
+ *
+ * Recovers the translation vector `t = 2 * dual * real*`.
+ */
+Vec3 DualQuat::translation() const
+{
+    const Quat t{ 2.f * dual * real.conjugated() };
+    return Vec3(t.x, t.y, t.z);
+}
+
+/**
+ * @brief Transform a Point.
+ *
+ * Rotates and then translates the point `p`.
+ */
+Vec3 DualQuat::transform(const Vec3& p) const
+{
+    return real.rotate(p) + translation();
+}
+
+/**
+ * @brief Conversion to Mat4.
+ *
+ * Creates the affine matrix of the rigid transformation. The translation is stored in the last column.
+ */
+Mat4 DualQuat::mat4() const
+{
+    Mat4 m{ real.mat4() };
+    const Vec3 t{ translation() };
+    m.at(0, 3) = t.x;
+    m.at(1, 3) = t.y;
+    m.at(2, 3) = t.z;
+    return m;
+}
+
+/**
+ * @brief Dual Quaternion Product.
+ *
+ * Composition of two rigid transformations: `p * q` applies `q` first.
+ */
+DualQuat vml::operator * (const DualQuat& p, const DualQuat& q)
+{
+    return DualQuat(p.real * q.real, p.real * q.dual + p.dual * q.real);
+}
+
+/**
+ * @brief Dual Quaternion Linear Blending.
+ *
+ * Blends two rigid transformations linearly and normalizes the result (DLB). Takes the shorter arc of the rotation.
+ */
+DualQuat vml::nlerp(const DualQuat& p, const DualQuat& q, Float t)
+{
+    const Float b{ (dot(p.real, q.real) < 0.f) ? -t : t };
+    return DualQuat((1.f - t) * p.real + b * q.real,
+                    (1.f - t) * p.dual + b * q.dual).normalized();
+}
+
+// ----------------------------------------------
+// Debugging
+
+/**
+ * @brief Print Overload.
+ *
+ * Prints the four components in the order x, y, z, w.
+ */
+std::ostream& ::vml::operator<< (std::ostream& os, const Quat& q)
+{
+    os << "(" << q.x << "," << q.y << "," << q.z << "," << q.w << ")";
+    return os;
+}
+
+/**
+ * @brief Print Overload.
+ *
+ * Prints the real and the dual part.
+ */
+std::ostream& ::vml::operator<< (std::ostream& os, const DualQuat& q)
+{
+    os << "[" << q.real << "," << q.dual << "]";
+    return os;
+}
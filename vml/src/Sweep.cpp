@@ -0,0 +1,206 @@
+#include "vml/Sweep.h"
+#include "vml/Intersection.h"
+
+#include <algorithm> // std::sort
+#include <limits>
+
+using namespace vml;
+
+// ----------------------------------------------
+// Local Functions
+
+/// positive infinity
+const Float _inf{ std::numeric_limits<Float>::infinity() };
+
+/// Distance between `p` and the closest point of the arc.
+static Float _distance(const Arc& a, const Vec2& p)
+{
+    return vml::distance(p, a.closestPoint(p));
+}
+
+/**
+ * @brief Interior Candidates.
+ *
+ * Points of `a` where the distance to `b` can have an interior minimum (not at an end point of either arc):
+ * for two circles these lie on the line through both centers, for a circle and a line on the normal of the line through the center.
+ * Their distances to `b` are taken with [closestPoint](@ref Arc::closestPoint), so candidates outside of `b` fall back to its end points.
+ */
+static Float _interior(const Arc& a, const Arc& b)
+{
+    if (a.isStraight()) return _inf;
+    const Vec2 ca{ a.center() };
+    const Float ra{ a.radius() };
+    Vec2 u;
+    if (b.isStraight())
+    {
+        const Vec2 t{ polar(b.ang) };
+        u = Vec2(-t.y, t.x);
+    }
+    else
+    {
+        u = b.center() - ca;
+        const Float n{ u.norm() };
+        if (n == 0.f) return _inf;
+        u = u / n;
+    }
+    Float best{ _inf };
+    for (const Vec2& p : { ca + ra * u, ca - ra * u })
+    {
+        const Vec2 d{ p - ca };
+        if (a.reaches(std::atan2(d.y, d.x))) best = std::min(best, _distance(b, p));
+    }
+    return best;
+}
+
+/// Largest distance of a point of the shape from the origin.
+static Float _reach(const ArcShape& shape)
+{
+    Float r{ 0.f };
+    for (const Arc& a : shape)
+    {
+        r = std::max(r, std::max(a.srt.norm(), a.end().norm()));
+        if (a.isStraight()) continue;
+        const Vec2 c{ a.center() };
+        const Float psi{ (c.norm() > 0.f) ? std::atan2(c.y, c.x) : 0.f };
+        if (a.reaches(psi)) r = std::max(r, c.norm() + a.radius());
+    }
+    return r;
+}
+
+// ----------------------------------------------
+// Motion
+
+/// Motion from the pose `(rot0, off0)` to the pose `(rot1, off1)`.
+Motion::Motion(Float _rot0, const Vec2& _off0, Float _rot1, const Vec2& _off1) :
+    rot0{ _rot0 }, off0{ _off0 }, rot1{ _rot1 }, off1{ _off1 }
+{}
+
+/// Static pose: the shape stays at `(rot, off)`.
+Motion::Motion(Float rot, const Vec2& off) : Motion(rot, off, rot, off)
+{}
+
+/// No motion: the shape stays where it is.
+Motion::Motion() : Motion(0.f, Vec2(0.f))
+{}
+
+/// The pose at time `t`, pass it to [ArcShape::transform](@ref ArcShape::transform).
+Transform2 Motion::at(Float t) const
+{
+    return Transform2(rot0 + t * (rot1 - rot0), off0 + t * (off1 - off0));
+}
+
+/**
+ * @brief Speed Bound.
+ *
+ * Upper bound for the distance a point at most `radius` away from the origin travels per unit of time:
+ * the rotation moves it by at most `|rot1 - rot0| * radius`, the offset by `|off1 - off0|`.
+ */
+Float Motion::speed(Float radius) const
+{
+    return abs(rot1 - rot0) * radius + vml::distance(off0, off1);
+}
+
+// ----------------------------------------------
+// Distances
+
+/**
+ * @brief Distance between two Arcs.
+ *
+ * The exact minimal distance between two arcs, 0 if they intersect.
+ * The minimum is either attained at an end point of one arc, or at an interior critical point, which lies on the line of the centers (two circles) or on the normal through the center (circle and line).
+ */
+Float vml::distance(const Arc& a, const Arc& b)
+{
+    Vec2 points[2];
+    if (intersect(a, b, points) > 0) return 0.f;
+
+    Float best{ std::min(std::min(_distance(b, a.srt), _distance(b, a.end())),
+                         std::min(_distance(a, b.srt), _distance(a, b.end()))) };
+    best = std::min(best, _interior(a, b));
+    best = std::min(best, _interior(b, a));
+    return best;
+}
+
+/**
+ * @brief Distance between two Shapes.
+ *
+ * The minimal distance between the outlines of two shapes, 0 if they [overlap](@ref overlaps) (also if one lies inside the other).
+ * Arc pairs are visited in the order of the distance of their bounding boxes, the search stops as soon as no box is closer than the best pair found.
+ */
+Float vml::distance(const ArcShape& a, const ArcShape& b)
+{
+    if (a.empty() || b.empty()) return _inf;
+    if (overlaps(a, b)) return 0.f;
+
+    std::vector<AABB2> ba, bb;
+    ba.reserve(a.size());
+    bb.reserve(b.size());
+    for (const Arc& arc : a) ba.push_back(arc.bounds());
+    for (const Arc& arc : b) bb.push_back(arc.bounds());
+
+    // lower bound of every pair by the distance of the boxes
+    std::vector<std::pair<Float, std::pair<std::size_t, std::size_t>>> pairs;
+    pairs.reserve(a.size() * b.size());
+    for (std::size_t i{0}; i < a.size(); i++)
+        for (std::size_t j{0}; j < b.size(); j++)
+        {
+            const Vec2 gap{ std::max(std::max(ba[i].lo.x - bb[j].hi.x, bb[j].lo.x - ba[i].hi.x), 0.f),
+                            std::max(std::max(ba[i].lo.y - bb[j].hi.y, bb[j].lo.y - ba[i].hi.y), 0.f) };
+            pairs.push_back({ gap.norm(), { i, j } });
+        }
+    std::sort(pairs.begin(), pairs.end(), [](const auto& p, const auto& q) { return p.first < q.first; });
+
+    Float best{ _inf };
+    for (const auto& p : pairs)
+    {
+        if (p.first >= best) break;
+        best = std::min(best, distance(a[p.second.first], b[p.second.second]));
+    }
+    return best;
+}
+
+// ----------------------------------------------
+// Continuous Collision Detection
+
+/**
+ * @brief Time of Contact (Conservative Advancement).
+ *
+ * Moves the shapes `a` and `b` along their motions and finds the earliest time `t` in [0, 1], at which they touch.
+ * At each step the exact [distance](@ref distance) `d` of the transformed shapes is computed. No point of either shape moves faster than the [speed bound](@ref Motion::speed),
+ * so the shapes can not touch before `t + d / (speedA + speedB)`, and time is advanced by exactly this amount. This never skips a contact, also not for thin shapes and fast rotations.
+ * The iteration stops if the distance falls below `tolerance` (contact) or the time passes 1 (no contact).
+ * Every step advances by more than `tolerance / (speedA + speedB)`, so the answer is always decided after at most `(speedA + speedB) / tolerance + 1` steps.
+ * The speed bound is loose for rotating shapes, which can make near misses of fast rotations expensive; a larger `tolerance` bounds the cost.
+ *
+ * @param a first shape, in its local coordinates
+ * @param ma motion of the first shape
+ * @param b second shape, in its local coordinates
+ * @param mb motion of the second shape
+ * @param [out] toc time of the first contact, only written on contact
+ * @param tolerance distance that counts as contact, larger than 0
+ * @return `true` if the shapes touch for some `t` in [0, 1]
+ */
+bool vml::timeOfContact(const ArcShape& a, const Motion& ma, const ArcShape& b, const Motion& mb, Float& toc, Float tolerance)
+{
+    assert(tolerance > 0.f);
+    const Float speed{ ma.speed(_reach(a)) + mb.speed(_reach(b)) };
+    ArcShape pa, pb;
+    Float t{ 0.f };
+    while (t <= 1.f)
+    {
+        pa = a; pa.transform(ma.at(t));
+        pb = b; pb.transform(mb.at(t));
+        const Float d{ distance(pa, pb) };
+        if (d <= tolerance)
+        {
+            toc = t;
+            return true;
+        }
+        // the shapes do not move relative to each other
+        if (speed <= 0.f) return false;
+        // steps below the resolution of t still have to advance it
+        const Float next{ t + d / speed };
+        t = (next > t) ? next : std::nextafter(t, 2.f);
+    }
+    return false;
+}
@@ -0,0 +1,348 @@
+#include "vml/Transform.h"
+
+using namespace vml;
+
+// ----------------------------------------------
+// Affine3: Constructors
+
+/**
+ * @brief Vector Constructor.
+ *
+ * Initializes the matrix with three row vectors, the same way as the [Mat4 constructor](@ref Mat4). The w-coordinates form the translation.
+ */
+Affine3::Affine3(const Vec4& ex, const Vec4& ey, const Vec4& ez) :
+M{
+    ex.x, ex.y, ex.z, ex.w,
+    ey.x, ey.y, ey.z, ey.w,
+    ez.x, ez.y, ez.z, ez.w,
+}{}
+
+/**
+ * @brief Rotation-Translation Constructor.
+ *
+ * Creates the transformation that first rotates by the unit quaternion `rot` and then translates by `off`.
+ */
+Affine3::Affine3(const Quat& rot, const Vec3& off)
+{
+    const Mat4 R{ rot.mat4() };
+    for (int row{0}; row < rows; row++)
+    {
+        for (int col{0}; col < rows; col++) at(row, col) = R.at(row, col);
+    }
+    at(0, 3) = off.x;
+    at(1, 3) = off.y;
+    at(2, 3) = off.z;
+}
+
+/**
+ * @brief Mat4 Conversion.
+ *
+ * Copies the upper three rows of `m`. The last row of `m` is ignored and assumed to be `(0, 0, 0, 1)`.
+ */
+Affine3::Affine3(const Mat4& m)
+{
+    for (int i{0}; i < fSize; i++) M[i] = m[i];
+}
+
+/**
+ * @brief Identity (Default Constructor).
+ */
+Affine3::Affine3() :
+Affine3(Vec4(1, 0, 0, 0),
+        Vec4(0, 1, 0, 0),
+        Vec4(0, 0, 1, 0))
+{}
+
+// ----------------------------------------------
+// Affine3: Access to entries
+
+/**
+ * @brief Data Pointer.
+ *
+ * Pointer to the first of the twelve entries (row-major).
+ */
+Float* Affine3::data()
+{
+    return &M[0];
+}
+
+///@{
+/**
+ * @brief Indexing.
+ *
+ * Direct access to the twelve entries in row-major order.
+ */
+Float& Affine3::operator[] (int i)
+{
+    return M[i];
+}
+const Float& Affine3::operator[] (int i) const
+{
+    return M[i];
+}
+///@}
+
+///@{
+/**
+ * @brief Row and Column Access.
+ *
+ * @param row index of the row (0 to 2)
+ * @param col index of the column (0 to 3)
+ */
+Float& Affine3::at(int row, int col)
+{
+    return M[row * cols + col];
+}
+Float Affine3::at(int row, int col) const
+{
+    return M[row * cols + col];
+}
+///@}
+
+/**
+ * @brief Translation Part.
+ *
+ * The last column of the matrix.
+ */
+Vec3 Affine3::translation() const
+{
+    return Vec3(M[3], M[7], M[11]);
+}
+
+// ----------------------------------------------
+// Affine3: Methods
+
+/**
+ * @brief Transform a Point.
+ *
+ * Applies the linear part and adds the translation.
+ */
+Vec3 Affine3::point(const Vec3& p) const
+{
+    return Vec3(M[0]*p.x + M[1]*p.y + M[ 2]*p.z + M[ 3],
+                M[4]*p.x + M[5]*p.y + M[ 6]*p.z + M[ 7],
+                M[8]*p.x + M[9]*p.y + M[10]*p.z + M[11]);
+}
+
+/**
+ * @brief Transform a Direction.
+ *
+ * Applies only the linear part, directions are not affected by translations.
+ */
+Vec3 Affine3::direction(const Vec3& v) const
+{
+    return Vec3(M[0]*v.x + M[1]*v.y + M[ 2]*v.z,
+                M[4]*v.x + M[5]*v.y + M[ 6]*v.z,
+                M[8]*v.x + M[9]*v.y + M[10]*v.z);
+}
+
+/**
+ * @brief Inverse Transformation.
+ *
+ * Inverts the 3x3 linear part with its adjugate and transforms the negated translation with it.
+ * ACHTUNG: singular matrices (e.g. a scaling by 0) cannot be inverted and cause a division by 0.
+ */
+Affine3 Affine3::inverse() const
+{
+    // cofactors of the first column
+    const Float c00{ M[5]*M[10] - M[6]*M[9] };
+    const Float c10{ M[6]*M[ 8] - M[4]*M[10] };
+    const Float c20{ M[4]*M[ 9] - M[5]*M[8] };
+    const Float inv{ 1.f / (M[0]*c00 + M[1]*c10 + M[2]*c20) };
+
+    Affine3 A;
+    A.at(0,0) = c00 * inv;
+    A.at(0,1) = (M[2]*M[9] - M[1]*M[10]) * inv;
+    A.at(0,2) = (M[1]*M[6] - M[2]*M[ 5]) * inv;
+    A.at(1,0) = c10 * inv;
+    A.at(1,1) = (M[0]*M[10] - M[2]*M[8]) * inv;
+    A.at(1,2) = (M[2]*M[ 4] - M[0]*M[6]) * inv;
+    A.at(2,0) = c20 * inv;
+    A.at(2,1) = (M[1]*M[8] - M[0]*M[9]) * inv;
+    A.at(2,2) = (M[0]*M[5] - M[1]*M[4]) * inv;
+
+    const Vec3 t{ A.direction(translation()) };
+    A.at(0,3) = -t.x;
+    A.at(1,3) = -t.y;
+    A.at(2,3) = -t.z;
+    return A;
+}
+
+/**
+ * @brief Conversion to Mat4.
+ *
+ * Appends the row `(0, 0, 0, 1)`.
+ */
+Mat4 Affine3::mat4() const
+{
+    return {
+        Vec4{ M[0], M[1], M[ 2], M[ 3] },
+        Vec4{ M[4], M[5], M[ 6], M[ 7] },
+        Vec4{ M[8], M[9], M[10], M[11] },
+        Vec4{ 0.f, 0.f, 0.f, 1.f }
+    };
+}
+
+/**
+ * @brief Composition.
+ *
+ * The product `a * b` describes the transformation `b` followed by `a`.
+ * The implicit last row `(0, 0, 0, 1)` is not multiplied, which saves 28 of the 64 multiplications of a Mat4 product.
+ */
+Affine3 vml::operator * (const Affine3& a, const Affine3& b)
+{
+    Affine3 C;
+    for (int row{0}; row < Affine3::rows; row++)
+    {
+        const Float r0{ a.at(row,0) }, r1{ a.at(row,1) }, r2{ a.at(row,2) };
+        for (int col{0}; col < Affine3::cols; col++)
+            C.at(row, col) = r0 * b.at(0,col) + r1 * b.at(1,col) + r2 * b.at(2,col);
+        C.at(row, 3) += a.at(row, 3);
+    }
+    return C;
+}
+
+/**
+ * @brief Print Overload.
+ *
+ * Prints the twelve entries row by row.
+ */
+std::ostream& vml::operator << (std::ostream& os, const Affine3& A)
+{
+    os << "(";
+    for (int row{0}; row < Affine3::rows; row++)
+    {
+        os << "\t";
+        for (int col{0}; col < Affine3::cols; col++)
+            os << A.at(row, col) << ((col < Affine3::cols-1) ? "," : "");
+        os << ((row < Affine3::rows-1) ? "" : "\t)") << "\n";
+    }
+    return os;
+}
+
+// ----------------------------------------------
+// Transform2: Constructors
+
+/**
+ * @brief Standard Constructor.
+ *
+ * Creates the transformation that rotates by `angle` around the origin and then moves by `offset`. Same parameters as [Arc::transform](@ref Arc::transform).
+ *
+ * @param angle rotation angle in radians
+ * @param offset offset, default = (0,0)
+ */
+Transform2::Transform2(Float angle, const Vec2& offset) :
+Transform2(angle, polar(angle), offset)
+{}
+
+/**
+ * @brief Identity (Default Constructor).
+ */
+Transform2::Transform2() :
+Transform2(0.f, Vec2(1.f, 0.f), Vec2(0.f))
+{}
+
+/**
+ * @brief Internal Constructor.
+ *
+ * Takes the precomputed rotation vector, so that composing and inverting need no trigonometric calls.
+ */
+Transform2::Transform2(Float _rot, const Vec2& _cs, const Vec2& _off) :
+rot(_rot), cs(_cs), off(_off)
+{}
+
+// ----------------------------------------------
+// Transform2: Access
+
+/// Rotation angle in radians.
+Float Transform2::angle() const
+{
+    return rot;
+}
+
+/// Rotation as unit vector `(cos, sin)`.
+const Vec2& Transform2::rotation() const
+{
+    return cs;
+}
+
+/// Offset, applied after the rotation.
+const Vec2& Transform2::offset() const
+{
+    return off;
+}
+
+// ----------------------------------------------
+// Transform2: Methods
+
+/**
+ * @brief Transform a Point.
+ *
+ * Rotates `p` around the origin and adds the offset. Gives the same result as `p.rotated(angle()) + offset()`.
+ */
+Vec2 Transform2::point(const Vec2& p) const
+{
+    return Vec2(cs.x * p.x - cs.y * p.y + off.x,
+                cs.y * p.x + cs.x * p.y + off.y);
+}
+
+/**
+ * @brief Transform a Direction.
+ *
+ * Only rotates `v`, directions are not affected by the offset.
+ */
+Vec2 Transform2::direction(const Vec2& v) const
+{
+    return Vec2(cs.x * v.x - cs.y * v.y,
+                cs.y * v.x + cs.x * v.y);
+}
+
+/**
+ * @brief Inverse Transformation.
+ *
+ * Rotates back by the negative angle and undoes the rotated offset.
+ */
+Transform2 Transform2::inverse() const
+{
+    const Vec2 ics{ cs.x, -cs.y };
+    return Transform2(-rot, ics, -Vec2(ics.x * off.x - ics.y * off.y,
+                                       ics.y * off.x + ics.x * off.y));
+}
+
+/**
+ * @brief Conversion to Mat4.
+ *
+ * Embeds the transformation into the x-y-plane of a 4x4 matrix. The z-axis is left unchanged.
+ */
+Mat4 Transform2::mat4() const
+{
+    return {
+        Vec4{ cs.x, -cs.y, 0.f, off.x },
+        Vec4{ cs.y,  cs.x, 0.f, off.y },
+        Vec4{  0.f,   0.f, 1.f,   0.f },
+        Vec4{  0.f,   0.f, 0.f,   1.f }
+    };
+}
+
+/**
+ * @brief Composition.
+ *
+ * The product `a * b` describes the transformation `b` followed by `a`. The rotations are multiplied as unit complex numbers.
+ */
+Transform2 vml::operator * (const Transform2& a, const Transform2& b)
+{
+    const Vec2 cs{ a.cs.x * b.cs.x - a.cs.y * b.cs.y,
+                   a.cs.y * b.cs.x + a.cs.x * b.cs.y };
+    return Transform2(a.rot + b.rot, cs, a.point(b.off));
+}
+
+/**
+ * @brief Print Overload.
+ *
+ * Prints the angle and the offset.
+ */
+std::ostream& vml::operator << (std::ostream& os, const Transform2& T)
+{
+    os << "transform( rot:" << T.angle() << ", off:" << T.offset() << ")";
+    return os;
+}
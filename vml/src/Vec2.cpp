@@ -1,7 +1,17 @@
 #include "vml/Vec2.h"
+#include "vml/Writer.h"
 
 using namespace vml;
 
+// ----------------------------------------------
+// Local Functions
+
+/// The generic vector of a Vec2, its operators build expressions instead of calling the Vec2 operators.
+inline const Vec<Float, 2>& _vec(const Vec2& v)
+{
+    return v;
+}
+
 // ----------------------------------------------
 // Constructors
 
@@ -10,7 +20,7 @@ using namespace vml;
  *
  * Initializes the two coordinates explicitly via parameter input. The order of the parameter corresponds to x, y.
  */
-Vec2::Vec2(Float _x, Float _y) : x(_x), y(_y)
+Vec2::Vec2(Float _x, Float _y) : Vec<Float, 2>(_x, _y)
 {}
 
 
@@ -43,77 +53,20 @@ Vec2::Vec2() : Vec2(0.f, 0.f)
  */
 Vec2 Vec2::operator -() const
 {
-    return Vec2(-x, -y);
+    return Vec2(-_vec(*this));
 }
 
-/**
- * @brief Add Assignment.
- *
- * Adds the attributes of a different Vec2 to the attributes of this Vec2.
- * @param other a Vec2 whose values are added to this Vec2's attributes
- */
-void Vec2::operator += (const Vec2& other)
-{
-    x += other.x; y += other.y;
-}
-
-/**
- * @brief Subtraction Assignment.
- *
- * Subtracts the attributes of a different Vec2 from the attributes of this Vec2.
- * @param other a Vec2 whose values are subtracted from this Vec2's attributes
- */
-void Vec2::operator -= (const Vec2& other)
-{
-    x -= other.x; y -= other.y;
-}
-
-/**
- * @brief Scalar Scaling.
- *
- * Scales the attributes linearly by multiplying them with a scalar factor.
- * @param factor scalar which in multiplied to all attributes
- */
-void Vec2::operator *= (Float factor)
-{
-    x *= factor; y *= factor;
-}
-
-/**
- * @brief Scalar Divison.
- *
- * Scales the attributes linearly by multiplying them with a scalar factor. The factor is the inverse of the given parameter
- * @param dividend scalar that all attributes are divided by
- */
-void Vec2::operator /= (Float dividend)
-{
-    Float factor{ 1.f / dividend};
-    x *= factor; y *= factor;
-}
-///@}
-
 // ----------------------------------------------
 // (Other) Methods
 
-/**
- * @brief Vector Length.
- *
- * Calculates the second vector norm, i.e., the Euclidian norm or the vector length. This is the square root all the sum of the squares of all attributes.
- */
-Float Vec2::norm() const
-{
-    return sqrt(x*x + y*y);
-}
-
 /**
  * @brief Unit Vector.
  *
- * Returns the a vector of length = 1, pointing in the same direction as this Vec4. This is done by dividing each attribute by the length of the vector.
+ * Returns the a vector of length = 1, pointing in the same direction as this Vec2. This is done by dividing each attribute by the length of the vector.
  */
 Vec2 Vec2::normalized() const
 {
-    Float l{ 1.f / norm() };
-    return Vec2(x*l, y*l);
+    return Vec2(_vec(*this) / norm());
 }
 
 /**
@@ -135,29 +88,28 @@ Vec2 Vec2::rotated(Float angle) const
 /**
  * @brief Vector Operatoren.
  *
- * Implementation of the binary operators (`+`,`-`,`*`,`/`)  for Vec4, which follow the standard math rules
+ * Implementation of the binary operators (`+`,`-`,`*`,`/`) for Vec2, which follow the standard math rules. They evaluate the expressions of the generic vector at once.
  */
 ///@{
 Vec2 vml::operator + (const Vec2& u, const Vec2& v)
 {
-    return Vec2(u.x + v.x, u.y + v.y);
+    return Vec2(_vec(u) + _vec(v));
 }
 Vec2 vml::operator - (const Vec2& u, const Vec2& v)
 {
-    return Vec2(u.x - v.x, u.y - v.y);
+    return Vec2(_vec(u) - _vec(v));
 }
 Vec2 vml::operator * (Float factor, const Vec2& v)
 {
-    return Vec2(factor * v.x, factor * v.y);
+    return Vec2(factor * _vec(v));
 }
 Vec2 vml::operator * (const Vec2& v, Float factor)
 {
-    return Vec2(factor * v.x, factor * v.y);
+    return Vec2(_vec(v) * factor);
 }
 Vec2 vml::operator / (const Vec2& v, Float dividend)
 {
-    Float factor{ 1.f / dividend };
-    return Vec2(factor * v.x, factor * v.y);
+    return Vec2(_vec(v) / dividend);
 }
 ///@}
 
@@ -168,7 +120,7 @@ Vec2 vml::operator / (const Vec2& v, Float dividend)
  */
 Float vml::distance(const Vec2& u, const Vec2& v)
 {
-    return (u - v).norm();
+    return distance(_vec(u), _vec(v));
 }
 
 
@@ -191,7 +143,7 @@ Vec2 vml::polar(Float angle)
  */
 Float vml::dot(const Vec2& u, const Vec2& v)
 {
-    return u.x * v.x + u.y * v.y;
+    return dot(_vec(u), _vec(v));
 }
 
 // ----------------------------------------------
@@ -199,10 +151,9 @@ Float vml::dot(const Vec2& u, const Vec2& v)
 
 std::string Vec2::TikZ(const char* optionals = "") const
 {
-    std::stringstream ss{};
-    ss << "\\draw[" << optionals << "] ";
-    ss << (*this) << " circle(5pt) ;";
-    return ss.str();
+    TikZWriter writer;
+    writer.write(*this, optionals);
+    return writer.str();
 }
 
 
@@ -2,6 +2,15 @@
 
 using namespace vml;
 
+// ----------------------------------------------
+// Lokale Funktionen
+
+/// Der generische Vektor eines Vec3, seine Operatoren bauen Ausdrücke, statt die Vec3-Operatoren aufzurufen.
+inline const Vec<Float, 3>& _vec(const Vec3& v)
+{
+    return v;
+}
+
 // ----------------------------------------------
 // Konstruktoren
 
@@ -10,7 +19,7 @@ using namespace vml;
  *
  * Initialisiert explizit die x-, y- und z-Koordinate des Vektors.
  */
-Vec3::Vec3(Float _x, Float _y, Float _z) : x(_x), y(_y), z(_z)
+Vec3::Vec3(Float _x, Float _y, Float _z) : Vec<Float, 3>(_x, _y, _z)
 {}
 
 /**
@@ -35,59 +44,37 @@ Vec3::Vec3() : Vec3(0.f, 0.f, 0.f)
 // ----------------------------------------------
 // Operatoren
 
-/**
- * @name Mutierende Operatoren
- *
- * Diese Funktionen veränderen die Daten des Vec3.
- */
-///@{
 /** Invertierung */
 Vec3 Vec3::operator -() const
 {
-    return Vec3(-x, -y, -z);
+    return Vec3(-_vec(*this));
 }
-/** Addition */
-void Vec3::operator += (const Vec3& other)
-{
-    x += other.x; y += other.y; z += other.z;
-}
-/** Subtraction */
-void Vec3::operator -= (const Vec3& other)
-{
-    x -= other.x; y -= other.y; z -= other.z;
-}
-/** Skalierung mit einem Skalar */
-void Vec3::operator *= (Float factor)
-{
-    x *= factor; y *= factor; z *= factor;
-}
-/** Invertierte Skalierung durch Division mit einem Skalar */
-void Vec3::operator /= (Float factor)
-{
-    x /= factor; y /= factor; z /= factor;
-}
-///@}
-
 
 /**
- * @brief Länge des Vektors.
+ * @brief Einheitsvektor.
  *
- * Berechnet die zweite Vektornorm (aka die Länge) des Vektors.
+ * Gibt den Vektor zurück, der in die selbe Richtung zeigt, aber eine Länge von 1 hat. Das wird durch das Dividieren mit der Länge des Vektors erreicht.
  */
-Float Vec3::norm() const
+Vec3 Vec3::normalized() const
 {
-    return sqrt(x*x + y*y + z*z);
+    return Vec3(_vec(*this) / norm());
 }
 
 /**
- * @brief Einheitsvektor.
+ * @brief Rotierter Vektor.
  *
- * Gibt den Vektor zurück, der in die selbe Richtung zeigt, aber eine Länge von 1 hat. Das wird durch das Dividieren mit der Länge des Vektors erreicht.
+ * Gibt den Vektor zurück, der um den Winkel `angle` um die Achse `axis` gedreht wurde (Rechte-Hand-Regel).
+ * Die Drehung erfolgt mit der [Rodrigues-Formel](https://de.wikipedia.org/wiki/Rodrigues-Formel), die Länge bleibt erhalten.
+ *
+ * @param angle Drehwinkel in Radiant
+ * @param axis Drehachse, muss nicht normiert sein
  */
-Vec3 Vec3::normalized() const
+Vec3 Vec3::rotated(Float angle, const Vec3& axis) const
 {
-    Float l { norm() };
-    return Vec3(x/l, y/l, z/l);
+    const Vec3 k{ axis.normalized() };
+    const Float c{ std::cos(angle) };
+    const Float s{ std::sin(angle) };
+    return c * (*this) + s * cross(k, *this) + ((1.f - c) * dot(k, *this)) * k;
 }
 
 // ----------------------------------------------
@@ -100,7 +87,7 @@ Vec3 Vec3::normalized() const
  */
 Vec3 vml::operator + (const Vec3& u, const Vec3& v)
 {
-    return Vec3(u.x + v.x, u.y + v.y, u.z + v.z);
+    return Vec3(_vec(u) + _vec(v));
 }
 
 /**
@@ -110,7 +97,7 @@ Vec3 vml::operator + (const Vec3& u, const Vec3& v)
  */
 Vec3 vml::operator - (const Vec3& u, const Vec3& v)
 {
-    return Vec3(u.x - v.x, u.y - v.y, u.z - v.z);
+    return Vec3(_vec(u) - _vec(v));
 }
 
 ///@{
@@ -121,11 +108,11 @@ Vec3 vml::operator - (const Vec3& u, const Vec3& v)
  */
 Vec3 vml::operator * (Float factor, const Vec3& v)
 {
-    return Vec3(factor * v.x, factor * v.y, factor * v.z);
+    return Vec3(factor * _vec(v));
 }
 Vec3 vml::operator * (const Vec3& v, Float factor)
 {
-    return Vec3(factor * v.x, factor * v.y, factor * v.z);
+    return Vec3(_vec(v) * factor);
 }
 ///@}
 
@@ -136,7 +123,7 @@ Vec3 vml::operator * (const Vec3& v, Float factor)
  */
 Vec3 vml::operator / (const Vec3& v, Float divident)
 {
-    return Vec3(v.x / divident, v.y / divident, v.z / divident);
+    return Vec3(_vec(v) / divident);
 }
 
 /**
@@ -147,8 +134,7 @@ Vec3 vml::operator / (const Vec3& v, Float divident)
  */
 Float vml::distance(const Vec3& u, const Vec3& v)
 {
-    Vec3 d{u - v};
-    return d.norm();
+    return distance(_vec(u), _vec(v));
 }
 
 /**
@@ -158,7 +144,7 @@ Float vml::distance(const Vec3& u, const Vec3& v)
  */
 Float vml::dot(const Vec3& u, const Vec3& v)
 {
-    return u.x * v.x + u.y * v.y + u.z * v.z;
+    return dot(_vec(u), _vec(v));
 }
 
 
@@ -183,9 +169,7 @@ Vec3 vml::orbit(Float yaw, Float pitch)
  */
 Vec3 vml::cross(const Vec3& u, const Vec3& v)
 {
-    return Vec3(u.y * v.z - u.z * v.y,
-                u.z * v.x - u.x * v.z,
-                u.x * v.y - u.y * v.x);
+    return Vec3(cross(_vec(u), _vec(v)));
 }
 
 // ----------------------------------------------
@@ -204,3 +188,43 @@ std::ostream& ::vml::operator<< (std::ostream& os, const Vec3& v)
     os << "(" << v.x << "," << v.y << "," << v.z << ")";
     return os;
 }
+
+// ----------------------------------------------
+// Parsing
+
+/**
+ * @brief String Parsing Vec3.
+ *
+ * Ließt einen Vec3 im Tupelformat "(x,y,z)". Verwendet [stoVec](@ref parse::stoVec) aus Vec.h.
+ */
+bool vml::parse::stoV3(Vec3& v3, const String& s)
+{
+    Vec<Float, 3> v;
+    if (!stoVec(v, s)) return false;
+    v3 = Vec3(v);
+    return true;
+}
+
+/**
+ * @brief Konvertiere String zu einem Vec3-Vector.
+ *
+ * Format: "[ (x1,y1,z1), (x2,y2,z2), ..., (xn,yn,zn) ]". Verwendet [stoVecVector](@ref parse::stoVecVector) aus Vec.h.
+ */
+bool vml::parse::stoV3vec(std::vector<Vec3>& v3v, const String& s)
+{
+    std::vector<Vec<Float, 3>> vv;
+    if (!stoVecVector(vv, s)) return false;
+    v3v.clear();
+    for (const Vec<Float, 3>& v : vv) v3v.push_back(Vec3(v));
+    return true;
+}
+
+/**
+ * @brief Vec3 als ein String.
+ *
+ * Verwendet das Klammerformat `(x,y,z)`.
+ */
+std::string vml::parse::toString(const Vec3& v)
+{
+    return toString(_vec(v));
+}
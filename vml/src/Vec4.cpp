@@ -2,6 +2,15 @@
 
 using namespace vml;
 
+// ----------------------------------------------
+// Local Functions
+
+/// The generic vector of a Vec4, its operators build expressions instead of calling the Vec4 operators.
+inline const Vec<Float, 4>& _vec(const Vec4& v)
+{
+    return v;
+}
+
 // ----------------------------------------------
 // Constructors
 
@@ -11,7 +20,7 @@ using namespace vml;
  * Initializes the four coordinates explicitly via parameter input. The order of the parameter corresponds to x, y, z, w.
  */
 Vec4::Vec4(Float _x, Float _y, Float _z, Float _w) :
-x(_x), y(_y), z(_z), w(_w)
+Vec<Float, 4>(_x, _y, _z, _w)
 {}
 
 /**
@@ -43,67 +52,12 @@ Vec4::Vec4() : Vec4(0.f, 0.f, 0.f, 0.f)
  */
 Vec4 Vec4::operator -() const
 {
-    return Vec4(-x, -y, -z, -w);
-}
-
-/**
- * @brief Add Assignment.
- *
- * Adds the attributes of a different Vec4 to the attributes of this Vec4.
- * @param other a Vec4 whose values are added to this Vec4's attributes
- */
-void Vec4::operator += (const Vec4& other)
-{
-    x += other.x; y += other.y; z += other.z; w += other.w;
-}
-
-/**
- * @brief Subtraction Assignment.
- *
- * Subtracts the attributes of a different Vec4 from the attributes of this Vec4.
- * @param other a Vec4 whose values are subtracted from this Vec4's attributes
- */
-void Vec4::operator -= (const Vec4& other)
-{
-    x -= other.x; y -= other.y; z -= other.z; w -= other.w;
-}
-
-/**
- * @brief Scalar Scaling.
- *
- * Scales the attributes linearly by multiplying them with a scalar factor.
- * @param factor scalar which in multiplied to all attributes
- */
-void Vec4::operator *= (Float factor)
-{
-    x *= factor; y *= factor; z *= factor; w *= factor;
-}
-
-/**
- * @brief Scalar Divison.
- *
- * Scales the attributes linearly by multiplying them with a scalar factor. The factor is the inverse of the given parameter
- * @param dividend scalar that all attributes are divided by
- */
-void Vec4::operator /= (Float dividend)
-{
-    Float factor{ 1.f/dividend };
-    x *= factor; y *= factor; z *= factor; w *= factor;
+    return Vec4(-_vec(*this));
 }
 
 // ----------------------------------------------
 // (Other) Methods
 
-/**
- * @brief Vector Length.
- *
- * Calculates the second vector norm, i.e., the Euclidian norm or the vector length. This is the square root all the sum of the squares of all attributes.
- */
-Float Vec4::norm() const
-{
-    return sqrt(x*x + y*y + z*z + w*w);
-}
-
 /**
  * @brief Unit Vector.
  *
@@ -111,8 +65,7 @@ Float Vec4::norm() const
  */
 Vec4 Vec4::normalized() const
 {
-    Float l{ 1.f / norm() };
-    return Vec4(x*l, y*l, z*l, w*l);
+    return Vec4(_vec(*this) / norm());
 }
 
 
@@ -133,29 +86,28 @@ std::array<Float, Vec4::size> Vec4::array() const
 /**
  * @brief Vector Operatoren.
  *
- * Implementation of the binary operators (`+`,`-`,`*`,`/`)  for Vec4, which follow the standard math rules
+ * Implementation of the binary operators (`+`,`-`,`*`,`/`) for Vec4, which follow the standard math rules. They evaluate the expressions of the generic vector at once.
  */
 ///@{
 Vec4 vml::operator + (const Vec4& u, const Vec4& v)
 {
-    return Vec4(u.x + v.x, u.y + v.y, u.z + v.z, u.w + v.w);
+    return Vec4(_vec(u) + _vec(v));
 }
 Vec4 vml::operator - (const Vec4& u, const Vec4& v)
 {
-    return Vec4(u.x - v.x, u.y - v.y, u.z - v.z, u.w + v.w);
+    return Vec4(_vec(u) - _vec(v));
 }
 Vec4 vml::operator * (const Vec4& v, Float factor)
 {
-    return Vec4(factor * v.x, factor * v.y, factor * v.z, factor * v.w);
+    return Vec4(_vec(v) * factor);
 }
 Vec4 vml::operator * (Float factor, const Vec4& v)
 {
-    return Vec4(factor * v.x, factor * v.y, factor * v.z, factor * v.w);
+    return Vec4(factor * _vec(v));
 }
 Vec4 vml::operator / (const Vec4& v, Float dividend)
 {
-    Float factor{ 1.f / dividend };
-    return Vec4(factor * v.x, factor * v.y, factor * v.z, factor * v.w);
+    return Vec4(_vec(v) / dividend);
 }
 ///@}
 
@@ -166,7 +118,7 @@ Vec4 vml::operator / (const Vec4& v, Float dividend)
  */
 Float vml::distance(const Vec4& u, const Vec4& v)
 {
-    return (u - v).norm();
+    return distance(_vec(u), _vec(v));
 }
 
 /**
@@ -176,7 +128,7 @@ Float vml::distance(const Vec4& u, const Vec4& v)
  */
 Float vml::dot(const Vec4& u, const Vec4& v)
 {
-    return u.x * v.x + u.y * v.y + u.z * v.z + u.w * v.w;
+    return dot(_vec(u), _vec(v));
 }
 
 // ----------------------------------------------
@@ -195,3 +147,43 @@ std::ostream& ::vml::operator<< (std::ostream& os, const Vec4& v)
     os << "(" << v.x << "," << v.y << "," << v.z << "," << v.w << ")";
     return os;
 }
+
+// ----------------------------------------------
+// Parsing
+
+/**
+ * @brief String Parsing Vec4.
+ *
+ * Reads a Vec4 in the tuple format "(x,y,z,w)". Uses [stoVec](@ref parse::stoVec) from Vec.h.
+ */
+bool vml::parse::stoV4(Vec4& v4, const String& s)
+{
+    Vec<Float, 4> v;
+    if (!stoVec(v, s)) return false;
+    v4 = Vec4(v);
+    return true;
+}
+
+/**
+ * @brief String to Vec4-Vector.
+ *
+ * Format: "[ (x1,y1,z1,w1), ..., (xn,yn,zn,wn) ]". Uses [stoVecVector](@ref parse::stoVecVector) from Vec.h.
+ */
+bool vml::parse::stoV4vec(std::vector<Vec4>& v4v, const String& s)
+{
+    std::vector<Vec<Float, 4>> vv;
+    if (!stoVecVector(vv, s)) return false;
+    v4v.clear();
+    for (const Vec<Float, 4>& v : vv) v4v.push_back(Vec4(v));
+    return true;
+}
+
+/**
+ * @brief Vec4 as a String.
+ *
+ * Uses the tuple format `(x,y,z,w)`.
+ */
+std::string vml::parse::toString(const Vec4& v)
+{
+    return toString(_vec(v));
+}
@@ -0,0 +1,200 @@
+#include "vml/Writer.h"
+
+#include <algorithm> // std::max
+#include <charconv>  // std::to_chars
+#include <cmath>     // std::ceil
+
+using namespace vml;
+
+// ----------------------------------------------
+// Writer
+
+/// Default Constructor: collects the text in the buffer.
+Writer::Writer() : os{ nullptr }, chunk{ 0 }
+{}
+
+/**
+ * @brief Stream Constructor.
+ *
+ * @param stream target stream, has to outlive the writer
+ * @param size buffer size in bytes that triggers writing to the stream
+ */
+Writer::Writer(std::ostream& stream, std::size_t size) : os{ &stream }, chunk{ size }
+{
+    buffer.reserve(chunk + 256);
+}
+
+/// Writes the remaining buffer to the stream.
+Writer::~Writer()
+{
+    flush();
+}
+
+/// The collected text. For stream writers only the part that was not written yet.
+const std::string& Writer::str() const
+{
+    return buffer;
+}
+
+/// Empties the buffer, the capacity is kept.
+void Writer::clear()
+{
+    buffer.clear();
+}
+
+/// Writes the buffer to the stream and empties it. Does nothing without a stream.
+void Writer::flush()
+{
+    if (!os) return;
+    os->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+}
+
+/// Writes the buffer to the stream, if it grew beyond `chunk` bytes.
+void Writer::spill()
+{
+    if (os && buffer.size() >= chunk) flush();
+}
+
+/// Appends a number in its shortest round trip representation.
+Writer& Writer::put(Float f)
+{
+    char text[32];
+    const std::to_chars_result result{ std::to_chars(text, text + sizeof(text), f) };
+    buffer.append(text, result.ptr);
+    return *this;
+}
+
+/// Appends a point in the bracket format `(x,y)`.
+Writer& Writer::put(const Vec2& v)
+{
+    buffer.push_back('(');
+    put(v.x);
+    buffer.push_back(',');
+    put(v.y);
+    buffer.push_back(')');
+    return *this;
+}
+
+/// Appends a string.
+Writer& Writer::put(const char* text)
+{
+    buffer.append(text);
+    return *this;
+}
+
+/// Appends a character.
+Writer& Writer::put(char c)
+{
+    buffer.push_back(c);
+    return *this;
+}
+
+// ----------------------------------------------
+// TikZWriter
+
+/// Writes a point as a small circle.
+TikZWriter& TikZWriter::write(const Vec2& v, const char* optionals)
+{
+    put("\\draw[").put(optionals).put("] ").put(v).put(" circle(5pt) ;");
+    spill();
+    return *this;
+}
+
+/**
+ * @brief Writes a single arc.
+ *
+ * Curved arcs use the `arc` command, straight arcs the line `--` to their end point. Like [Arc::TikZ](@ref Arc::TikZ) this is only a path segment and needs a start point.
+ */
+TikZWriter& TikZWriter::write(const Arc& a)
+{
+    if (a.isStraight())
+    {
+        put("-- ").put(a.end()).put(' ');
+    }
+    else
+    {
+        const Float sa{ degree(a.ang - sign(a.crv) * .5f*pi) };
+        const Float ea{ sa + degree(a.centralAngle()) };
+        put("arc(").put(sa).put(':').put(ea).put(':').put(a.radius()).put(") ");
+    }
+    return *this;
+}
+
+/// Writes a shape as one `\draw` command, starting at the first arc.
+TikZWriter& TikZWriter::write(const ArcShape& shape, const char* optionals)
+{
+    if (shape.empty()) return *this;
+    put("\\draw[").put(optionals).put("] ").put(shape[0].srt).put(' ');
+    for (const Arc& a : shape) write(a);
+    put(';');
+    spill();
+    return *this;
+}
+
+// ----------------------------------------------
+// SVGWriter
+
+/// Opens an SVG document with the given view box.
+SVGWriter& SVGWriter::begin(const AABB2& viewBox)
+{
+    const Vec2 size{ viewBox.size() };
+    put("<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"");
+    put(viewBox.lo.x).put(' ').put(viewBox.lo.y).put(' ').put(size.x).put(' ').put(size.y).put("\">\n");
+    spill();
+    return *this;
+}
+
+/// Closes the SVG document.
+SVGWriter& SVGWriter::end()
+{
+    put("</svg>\n");
+    spill();
+    return *this;
+}
+
+/// Writes a shape as a closed `<path>` element with the given attributes.
+SVGWriter& SVGWriter::path(const ArcShape& shape, const char* attributes)
+{
+    put("<path ").put(attributes).put(" d=\"");
+    pathData(shape);
+    put("\"/>\n");
+    spill();
+    return *this;
+}
+
+/// Writes the path data of a closed shape: `M` to the first start point, one command per arc and `Z`.
+SVGWriter& SVGWriter::pathData(const ArcShape& shape)
+{
+    if (shape.empty()) return *this;
+    put('M').put(shape[0].srt.x).put(' ').put(shape[0].srt.y);
+    for (const Arc& a : shape) pathData(a);
+    put('Z');
+    return *this;
+}
+
+/**
+ * @brief Path Data of an Arc.
+ *
+ * Straight arcs become a line `L` to the end point, curved arcs an elliptical arc `A` with equal radii.
+ * An `A` command can not describe a full circle (start and end point coincide), so arcs with a central angle above 180 degrees are split into equal parts of at most 180 degrees.
+ * The sweep flag is set for left turns (positive curvature).
+ */
+SVGWriter& SVGWriter::pathData(const Arc& a)
+{
+    if (a.isStraight())
+    {
+        const Vec2 e{ a.end() };
+        put(" L").put(e.x).put(' ').put(e.y);
+        return *this;
+    }
+    const int parts{ std::max(1, static_cast<int>(std::ceil(abs(a.centralAngle()) / pi - 1e-4f))) };
+    const Float r{ a.radius() };
+    const char* flags{ (a.crv > 0.f) ? " 0 0 1 " : " 0 0 0 " };
+    for (int i{1}; i <= parts; i++)
+    {
+        const Vec2 e{ a.atLength(a.lng * i / parts) };
+        put(" A").put(r).put(' ').put(r).put(flags).put(e.x).put(' ').put(e.y);
+    }
+    return *this;
+}